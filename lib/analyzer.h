@@ -184,6 +184,10 @@ struct Analyzer {
     virtual bool invalid() const {
         return false;
     }
+    /// If true then analyzing tok would return Action::None and tok can not change the analyzed value
+    virtual bool isIndependent(const Token* /*tok*/) const {
+        return false;
+    }
     virtual ~Analyzer() = default;
     Analyzer(const Analyzer&) = default;
 protected:
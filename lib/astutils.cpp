@@ -40,6 +40,7 @@
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <list>
 #include <set>
 #include <type_traits>
@@ -884,6 +885,55 @@ const Token *findNextTokenFromBreak(const Token *breakToken)
     return nullptr;
 }
 
+// Get the constant step of "i++", "i--", "i += c", "i -= c" and "i = i + c", or 0 if the step is not constant
+static MathLib::bigint getForLoopStep(const Token* incExpr, nonneg int varid)
+{
+    if (!incExpr)
+        return 0;
+    if (incExpr->tokType() == Token::eIncDecOp && incExpr->astOperand1() && incExpr->astOperand1()->varId() == varid)
+        return incExpr->str() == "++" ? 1 : -1;
+    if (!Token::Match(incExpr, "+=|-=|=") || !incExpr->isBinaryOp() || incExpr->astOperand1()->varId() != varid)
+        return 0;
+    const Token* stepTok = incExpr->astOperand2();
+    bool negate = incExpr->str() == "-=";
+    if (incExpr->str() == "=") {
+        if (!Token::Match(stepTok, "+|-") || !stepTok->isBinaryOp())
+            return 0;
+        negate = stepTok->str() == "-";
+        if (stepTok->astOperand1()->varId() == varid)
+            stepTok = stepTok->astOperand2();
+        else if (!negate && stepTok->astOperand2()->varId() == varid)
+            stepTok = stepTok->astOperand1();
+        else
+            return 0;
+    }
+    if (!stepTok->hasKnownIntValue() || stepTok->getKnownIntValue() <= 0)
+        return 0;
+    if (negate && stepTok->getKnownIntValue() == std::numeric_limits<MathLib::bigint>::min())
+        return 0;
+    return negate ? -stepTok->getKnownIntValue() : stepTok->getKnownIntValue();
+}
+
+// Set result to a + b, or return false if that overflows
+static bool addWithoutOverflow(MathLib::bigint a, MathLib::bigint b, MathLib::bigint &result)
+{
+    if ((b > 0 && a > std::numeric_limits<MathLib::bigint>::max() - b) ||
+        (b < 0 && a < std::numeric_limits<MathLib::bigint>::min() - b))
+        return false;
+    result = a + b;
+    return true;
+}
+
+// Set result to a - b, or return false if that overflows
+static bool subtractWithoutOverflow(MathLib::bigint a, MathLib::bigint b, MathLib::bigint &result)
+{
+    if ((b < 0 && a > std::numeric_limits<MathLib::bigint>::max() + b) ||
+        (b > 0 && a < std::numeric_limits<MathLib::bigint>::min() + b))
+        return false;
+    result = a - b;
+    return true;
+}
+
 bool extractForLoopValues(const Token *forToken,
                           nonneg int &varid,
                           bool &knownInitValue,
@@ -911,6 +961,32 @@ bool extractForLoopValues(const Token *forToken,
     knownInitValue = initExpr->astOperand2()->hasKnownIntValue();
     initValue = minInitValue.front();
     partialCond = Token::Match(condExpr, "%oror%|&&");
+    stepValue = getForLoopStep(incExpr, varid);
+    if (stepValue == 0)
+        return false;
+    if (stepValue < 0) {
+        // The last value of a counting down loop depends on the init value
+        if (partialCond || !knownInitValue)
+            return false;
+        if (!Token::Match(condExpr, ">|>=") || !condExpr->isBinaryOp() || condExpr->astOperand1()->varId() != varid || !condExpr->astOperand2()->hasKnownIntValue())
+            return false;
+        MathLib::bigint bound = 0;
+        if (!addWithoutOverflow(condExpr->astOperand2()->getKnownIntValue(), condExpr->str() == ">" ? 1 : 0, bound))
+            return false;
+        MathLib::bigint distance = 0;
+        if (initValue < bound)
+            lastValue = bound;
+        else if (subtractWithoutOverflow(initValue, bound, distance))
+            lastValue = initValue - (distance / -stepValue) * -stepValue;
+        else
+            return false;
+        // The value after the last iteration must be representable
+        MathLib::bigint afterValue = 0;
+        if (!addWithoutOverflow(lastValue, stepValue, afterValue))
+            return false;
+        // Unsigned loop variable wraps around instead of leaving the loop
+        return afterValue >= 0 || !astIsUnsigned(incExpr->astOperand1());
+    }
     visitAstNodes(condExpr, [varid, &condExpr](const Token *tok) {
         if (Token::Match(tok, "%oror%|&&"))
             return ChildrenToVisit::op1_and_op2;
@@ -922,14 +998,26 @@ bool extractForLoopValues(const Token *forToken,
     });
     if (!Token::Match(condExpr, "<|<=") || !condExpr->isBinaryOp() || condExpr->astOperand1()->varId() != varid || !condExpr->astOperand2()->hasKnownIntValue())
         return false;
-    if (!incExpr || !incExpr->isUnaryOp("++") || incExpr->astOperand1()->varId() != varid)
+    MathLib::bigint bound = 0;
+    if (!subtractWithoutOverflow(condExpr->astOperand2()->getKnownIntValue(), condExpr->str() == "<" ? 1 : 0, bound))
         return false;
-    stepValue = 1;
-    if (condExpr->str() == "<")
-        lastValue = condExpr->astOperand2()->getKnownIntValue() - 1;
-    else
-        lastValue = condExpr->astOperand2()->getKnownIntValue();
-    return true;
+    if (stepValue == 1) {
+        lastValue = bound;
+    } else {
+        // Larger steps can skip the bound so the last value depends on the init value
+        if (!knownInitValue)
+            return false;
+        MathLib::bigint distance = 0;
+        if (initValue > bound)
+            lastValue = bound;
+        else if (subtractWithoutOverflow(bound, initValue, distance))
+            lastValue = initValue + (distance / stepValue) * stepValue;
+        else
+            return false;
+    }
+    // The value after the last iteration must be representable
+    MathLib::bigint afterValue = 0;
+    return addWithoutOverflow(lastValue, stepValue, afterValue);
 }
 
 
@@ -997,6 +1085,9 @@ bool isAliasOf(const Token *tok, nonneg int varid, bool* inconclusive)
 
 bool isAliasOf(const Token* tok, const Token* expr, bool* inconclusive)
 {
+    // Only lifetime and symbolic values can make tok an alias
+    if (tok->values().empty())
+        return false;
     const bool pointer = astIsPointer(tok);
     const ValueFlow::Value* value = nullptr;
     const Token* r = findAstNode(expr, [&](const Token* childTok) {
@@ -1491,12 +1582,20 @@ bool isSameExpression(bool cpp, bool macro, const Token *tok1, const Token *tok2
 
     // Follow variable
     if (followVar && !tok_str_eq && (tok1->varId() || tok2->varId())) {
-        const Token * varTok1 = followVariableExpression(tok1, cpp, tok2);
+        // Following a variable checks that it is not changed until the end of
+        // its scope. Only do that when its init expression could match.
+        const Token* initTok1 = getVariableInitExpression(tok1->variable());
+        const Token* initTok2 = getVariableInitExpression(tok2->variable());
+        auto mayMatch = [&](const Token* t1, const Token* t2) {
+            return t1 && t2 && ((t1->str() == t2->str()) || isSameConstantValue(macro, t1, t2));
+        };
+        const bool followBoth = mayMatch(initTok1, initTok2);
+        const Token * varTok1 = (followBoth || mayMatch(initTok1, tok2)) ? followVariableExpression(tok1, cpp, tok2) : tok1;
         if ((varTok1->str() == tok2->str()) || isSameConstantValue(macro, varTok1, tok2)) {
             followVariableExpressionError(tok1, varTok1, errors);
             return isSameExpression(cpp, macro, varTok1, tok2, library, true, followVar, errors);
         }
-        const Token * varTok2 = followVariableExpression(tok2, cpp, tok1);
+        const Token * varTok2 = (followBoth || mayMatch(tok1, initTok2)) ? followVariableExpression(tok2, cpp, tok1) : tok2;
         if ((tok1->str() == varTok2->str()) || isSameConstantValue(macro, tok1, varTok2)) {
             followVariableExpressionError(tok2, varTok2, errors);
             return isSameExpression(cpp, macro, tok1, varTok2, library, true, followVar, errors);
@@ -1682,6 +1781,52 @@ bool isSameExpression(bool cpp, bool macro, const Token *tok1, const Token *tok2
     return commutativeEquals;
 }
 
+static std::size_t combineHash(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+static std::size_t computeExpressionHash(bool cpp, const Token* tok, std::unordered_map<const Token*, std::size_t>& cache)
+{
+    // Skip the same tokens as isSameExpression()
+    if (cpp && tok->str() == "." && Token::simpleMatch(tok->astOperand1(), "this"))
+        return getExpressionHash(cpp, tok->astOperand2(), cache);
+    if (Token::simpleMatch(tok, "!") && Token::simpleMatch(tok->astOperand1(), "!"))
+        return getExpressionHash(cpp, tok->astOperand1()->astOperand1(), cache);
+    const Token* refTok = followReferences(tok);
+    if (refTok != tok)
+        return refTok ? getExpressionHash(cpp, refTok, cache) : 1;
+
+    const Token* op1 = tok->astOperand1();
+    const Token* op2 = tok->astOperand2();
+    std::size_t h = std::hash<std::string>{}(tok->str());
+    // a>b is the same as b<a
+    if (Token::Match(tok, ">|>=")) {
+        h = std::hash<std::string>{}(tok->str() == ">" ? "<" : "<=");
+        std::swap(op1, op2);
+    }
+    h = combineHash(h, tok->varId());
+    std::size_t h1 = getExpressionHash(cpp, op1, cache);
+    std::size_t h2 = getExpressionHash(cpp, op2, cache);
+    if (tok->isBinaryOp() && Token::Match(tok, "%or%|%oror%|+|*|&|&&|^|==|!=") && h2 < h1)
+        std::swap(h1, h2);
+    return combineHash(combineHash(h, h1), h2);
+}
+
+std::size_t getExpressionHash(bool cpp, const Token* tok, std::unordered_map<const Token*, std::size_t>& cache)
+{
+    if (!tok)
+        return 0;
+    const auto it = cache.find(tok);
+    if (it != cache.end())
+        return it->second;
+    // Ends a cycle of references
+    cache[tok] = 0;
+    const std::size_t h = computeExpressionHash(cpp, tok, cache);
+    cache[tok] = h;
+    return h;
+}
+
 static bool isZeroBoundCond(const Token * const cond)
 {
     if (cond == nullptr)
@@ -2670,10 +2815,16 @@ const Token* findExpression(const Token* start, const nonneg int exprid)
     const Scope* scope = f->functionScope;
     if (!scope)
         return nullptr;
-    for (const Token *tok = scope->bodyStart; tok != scope->bodyEnd; tok = tok->next()) {
-        if (tok->exprId() != exprid)
-            continue;
-        return tok;
+    if (!precedes(scope->bodyStart, start) || !precedes(start, scope->bodyEnd))
+        start = scope->bodyStart;
+    // The expression is usually used just before start, so look there first
+    for (const Token *tok = start; tok != scope->bodyStart; tok = tok->previous()) {
+        if (tok->exprId() == exprid)
+            return tok;
+    }
+    for (const Token *tok = start; tok != scope->bodyEnd; tok = tok->next()) {
+        if (tok->exprId() == exprid)
+            return tok;
     }
     return nullptr;
 }
@@ -3283,7 +3434,7 @@ bool isNullOperand(const Token *expr)
     if (expr->valueType() && expr->valueType()->pointer == 0)
         return false;
     const Token *castOp = expr->astOperand2() ? expr->astOperand2() : expr->astOperand1();
-    return Token::Match(castOp, "NULL|nullptr") || (MathLib::isInt(castOp->str()) && MathLib::isNullValue(castOp->str()));
+    return Token::Match(castOp, "NULL|nullptr") || (castOp->isIntNumber() && MathLib::isNullValue(castOp->str()));
 }
 
 bool isGlobalData(const Token *expr, bool cpp)
@@ -22,10 +22,12 @@
 #define astutilsH
 //---------------------------------------------------------------------------
 
+#include <cstddef>
 #include <functional>
 #include <stack>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "config.h"
@@ -216,7 +218,8 @@ const Token* getCondTokFromEnd(const Token* endBlock);
 const Token *findNextTokenFromBreak(const Token *breakToken);
 
 /**
- * Extract for loop values: loopvar varid, init value, step value, last value (inclusive)
+ * Extract for loop values: loopvar varid, init value, step value (negative when counting down), last value (inclusive)
+ * Returns false if a value, or last value + step value, does not fit in MathLib::bigint
  */
 bool extractForLoopValues(const Token *forToken,
                           nonneg int &varid,
@@ -245,6 +248,15 @@ const Token* followReferences(const Token* tok, ErrorPath* errors = nullptr);
 
 CPPCHECKLIB bool isSameExpression(bool cpp, bool macro, const Token *tok1, const Token *tok2, const Library& library, bool pure, bool followVar, ErrorPath* errors=nullptr);
 
+/**
+ * Structural hash of an expression. Expressions that isSameExpression() considers equal when
+ * followVar is false get the same hash, so only expressions with the same hash need to be compared.
+ * Expressions that are only equal because of their known values can get different hashes, so
+ * this is meant for tokens without values, for instance when the expression ids are assigned.
+ * \param cache   hashes of the already visited tokens
+ */
+std::size_t getExpressionHash(bool cpp, const Token* tok, std::unordered_map<const Token*, std::size_t>& cache);
+
 bool isEqualKnownValue(const Token * const tok1, const Token * const tok2);
 
 bool isStructuredBindingVariable(const Variable* var);
@@ -79,6 +79,18 @@ public:
     /** run checks, the token list is not simplified */
     virtual void runChecks(const Tokenizer *, const Settings *, ErrorLogger *) = 0;
 
+    /**
+     * Cheap test if runChecks() can find anything. When false is returned the checks are skipped.
+     * Names in the code can be looked up with Tokenizer::tokensWithStr().
+     * @param tokenizer tokenizer
+     * @param settings settings
+     */
+    virtual bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const {
+        (void)tokenizer;
+        (void)settings;
+        return true;
+    }
+
     /** get error messages */
     virtual void getErrorMessages(ErrorLogger *errorLogger, const Settings *settings) const = 0;
 
@@ -41,6 +41,11 @@ namespace {
     Check64BitPortability instance;
 }
 
+bool Check64BitPortability::canRunChecks(const Tokenizer * /*tokenizer*/, const Settings *settings) const
+{
+    return settings->severity.isEnabled(Severity::portability);
+}
+
 void Check64BitPortability::pointerassignment()
 {
     if (!mSettings->severity.isEnabled(Severity::portability))
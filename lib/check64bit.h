@@ -55,6 +55,8 @@ public:
         check64BitPortability.pointerassignment();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const override;
+
     /** Check for pointer assignment */
     void pointerassignment();
 
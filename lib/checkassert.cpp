@@ -39,6 +39,11 @@ namespace {
     CheckAssert instance;
 }
 
+bool CheckAssert::canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const
+{
+    return settings->severity.isEnabled(Severity::warning) && !tokenizer->tokensWithStr("assert").empty();
+}
+
 void CheckAssert::assertWithSideEffects()
 {
     if (!mSettings->severity.isEnabled(Severity::warning))
@@ -53,6 +53,8 @@ public:
         checkAssert.assertWithSideEffects();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const override;
+
     void assertWithSideEffects();
 
 protected:
@@ -55,6 +55,10 @@ public:
         checkBoost.checkBoostForeachModification();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings * /*settings*/) const override {
+        return tokenizer->isCPP() && !tokenizer->tokensWithStr("BOOST_FOREACH").empty();
+    }
+
     /** @brief %Check for container modification while using the BOOST_FOREACH macro */
     void checkBoostForeachModification();
 
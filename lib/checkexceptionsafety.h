@@ -67,6 +67,11 @@ public:
         checkExceptionSafety.rethrowNoCurrentException();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings * /*settings*/) const override {
+        return tokenizer->isCPP() &&
+               (!tokenizer->tokensWithStr("throw").empty() || !tokenizer->tokensWithStr("catch").empty() || !tokenizer->tokensWithStr("noexcept").empty());
+    }
+
     /** Don't throw exceptions in destructors */
     void destructors();
 
@@ -62,6 +62,10 @@ public:
         checkInternal.checkRedundantTokCheck();
     }
 
+    bool canRunChecks(const Tokenizer * /*tokenizer*/, const Settings *settings) const override {
+        return settings->checks.isEnabled(Checks::internalCheck);
+    }
+
     /** @brief %Check if a simple pattern is used inside Token::Match or Token::findmatch */
     void checkTokenMatchPatterns();
 
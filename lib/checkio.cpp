@@ -58,6 +58,30 @@ static const CWE CWE687(687U);  // Function Call With Incorrectly Specified Argu
 static const CWE CWE704(704U);  // Incorrect Type Conversion or Cast
 static const CWE CWE910(910U);  // Use of Expired File Descriptor
 
+bool CheckIO::canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const
+{
+    // names that checkCoutCerrMisusage(), checkFileUsage(), invalidScanf() and the
+    // hardcoded functions in checkWrongPrintfScanfArguments() look for
+    static const std::set<std::string> names = {
+        "cout", "cerr",
+        "FILE", "fopen", "freopen", "tmpfile", "_wfopen", "_wfreopen", "fopen_s", "freopen_s", "_wfopen_s", "_wfreopen_s", "fclose", "fflush",
+        "scanf", "vscanf", "sscanf", "vsscanf", "fscanf", "vfscanf",
+        "swprintf", "sprintf_s", "swprintf_s", "_snprintf_s", "_snwprintf_s"
+    };
+    if (std::any_of(names.cbegin(), names.cend(), [&](const std::string &name) {
+        return !tokenizer->tokensWithStr(name).empty();
+    }))
+        return true;
+
+    // functions with a format string in the library
+    return std::any_of(settings->library.functions.cbegin(), settings->library.functions.cend(), [&](const std::pair<const std::string, Library::Function> &f) {
+        if (!f.second.formatstr)
+            return false;
+        const std::string::size_type pos = f.first.rfind("::");
+        return !tokenizer->tokensWithStr(pos == std::string::npos ? f.first : f.first.substr(pos + 2)).empty();
+    });
+}
+
 //---------------------------------------------------------------------------
 //    std::cout << std::cout;
 //---------------------------------------------------------------------------
@@ -58,6 +58,8 @@ public:
         checkIO.invalidScanf();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const override;
+
     /** @brief %Check for missusage of std::cout */
     void checkCoutCerrMisusage();
 
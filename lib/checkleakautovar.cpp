@@ -429,7 +429,7 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
 
             // Assigning non-zero value variable. It might be used to
             // track the execution for a later if condition.
-            if (Token::Match(varTok->tokAt(2), "%num% ;") && MathLib::toLongNumber(varTok->strAt(2)) != 0)
+            if (Token::Match(varTok->tokAt(2), "%num% ;") && varTok->tokAt(2)->toLongNumber() != 0)
                 notzero.insert(varTok->varId());
             else if (Token::Match(varTok->tokAt(2), "- %type% ;") && varTok->tokAt(3)->isUpperCaseName())
                 notzero.insert(varTok->varId());
@@ -492,7 +492,16 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
 
             if (Token::simpleMatch(closingParenthesis, ") {")) {
                 VarInfo varInfo1(varInfo);  // VarInfo for if code
-                VarInfo varInfo2(varInfo);  // VarInfo for else code
+                VarInfo varInfo2;           // VarInfo for else code
+                varInfo2.swap(varInfo);
+
+                // Variables allocated before the if. varInfo is moved into the
+                // else branch so only the keys need to be copied.
+                std::vector<int> oldAlloc;
+                oldAlloc.reserve(varInfo2.alloctype.size());
+                for (const std::pair<const int, VarInfo::AllocInfo> &alloc : varInfo2.alloctype)
+                    oldAlloc.push_back(alloc.first);
+                const std::set<int> oldConditionalAlloc(varInfo2.conditionalAlloc);
 
                 // Skip expressions before commas
                 const Token * astOperand2AfterCommas = tok->next()->astOperand2();
@@ -554,14 +563,10 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
                     tok = closingParenthesis->previous();
                 }
 
-                VarInfo old;
-                old.swap(varInfo);
-
                 std::map<int, VarInfo::AllocInfo>::const_iterator it;
 
-                for (it = old.alloctype.cbegin(); it != old.alloctype.cend(); ++it) {
-                    const int varId = it->first;
-                    if (old.conditionalAlloc.find(varId) == old.conditionalAlloc.end())
+                for (const int varId : oldConditionalAlloc) {
+                    if (!std::binary_search(oldAlloc.cbegin(), oldAlloc.cend(), varId))
                         continue;
                     if (varInfo1.alloctype.find(varId) == varInfo1.alloctype.end() ||
                         varInfo2.alloctype.find(varId) == varInfo2.alloctype.end()) {
@@ -573,7 +578,7 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
                 // Conditional allocation in varInfo1
                 for (it = varInfo1.alloctype.cbegin(); it != varInfo1.alloctype.cend(); ++it) {
                     if (varInfo2.alloctype.find(it->first) == varInfo2.alloctype.end() &&
-                        old.alloctype.find(it->first) == old.alloctype.end()) {
+                        !std::binary_search(oldAlloc.cbegin(), oldAlloc.cend(), it->first)) {
                         varInfo.conditionalAlloc.insert(it->first);
                     }
                 }
@@ -581,7 +586,7 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
                 // Conditional allocation in varInfo2
                 for (it = varInfo2.alloctype.cbegin(); it != varInfo2.alloctype.cend(); ++it) {
                     if (varInfo1.alloctype.find(it->first) == varInfo1.alloctype.end() &&
-                        old.alloctype.find(it->first) == old.alloctype.end()) {
+                        !std::binary_search(oldAlloc.cbegin(), oldAlloc.cend(), it->first)) {
                         varInfo.conditionalAlloc.insert(it->first);
                     }
                 }
@@ -600,10 +605,11 @@ bool CheckLeakAutoVar::checkScope(const Token * const startToken,
                     }
                 }
 
-                alloctype.insert(varInfo1.alloctype.cbegin(), varInfo1.alloctype.cend());
+                // varInfo is empty here, the if branch wins when both branches have a variable
+                alloctype.swap(varInfo1.alloctype);
                 alloctype.insert(varInfo2.alloctype.cbegin(), varInfo2.alloctype.cend());
 
-                possibleUsage.insert(varInfo1.possibleUsage.cbegin(), varInfo1.possibleUsage.cend());
+                possibleUsage.swap(varInfo1.possibleUsage);
                 possibleUsage.insert(varInfo2.possibleUsage.cbegin(), varInfo2.possibleUsage.cend());
             }
         }
@@ -496,6 +496,11 @@ void CheckMemoryLeakInFunction::checkReallocUsage() const
 //---------------------------------------------------------------------------
 
 
+bool CheckMemoryLeakInClass::canRunChecks(const Tokenizer *tokenizer, const Settings * /*settings*/) const
+{
+    return tokenizer->isCPP() && !tokenizer->getSymbolDatabase()->classAndStructScopes.empty();
+}
+
 void CheckMemoryLeakInClass::check()
 {
     const SymbolDatabase *symbolDatabase = mTokenizer->getSymbolDatabase();
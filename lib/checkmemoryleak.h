@@ -232,6 +232,8 @@ public:
         checkMemoryLeak.check();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const override;
+
     void check();
 
 private:
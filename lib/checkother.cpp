@@ -2108,9 +2108,7 @@ void CheckOther::checkNanInArithmeticExpression()
 {
     if (!mSettings->severity.isEnabled(Severity::style))
         return;
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
-        if (tok->str() != "/")
-            continue;
+    for (const Token *tok : mTokenizer->tokensWithStr("/")) {
         if (!Token::Match(tok->astParent(), "[+-]"))
             continue;
         if (Token::simpleMatch(tok->astOperand2(), "0.0"))
@@ -3023,7 +3021,7 @@ void CheckOther::checkIncompleteArrayFill()
                 if (!var || !var->isArray() || var->dimensions().empty() || !var->dimension(0))
                     continue;
 
-                if (MathLib::toLongNumber(tok->linkAt(1)->strAt(-1)) == var->dimension(0)) {
+                if (tok->linkAt(1)->tokAt(-1)->toLongNumber() == var->dimension(0)) {
                     int size = mTokenizer->sizeOfType(var->typeStartToken());
                     if (size == 0 && var->valueType()->pointer)
                         size = mSettings->platform.sizeof_pointer;
@@ -3797,11 +3795,9 @@ void CheckOther::checkModuloOfOne()
     if (!mSettings->severity.isEnabled(Severity::style))
         return;
 
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
+    for (const Token *tok : mTokenizer->tokensWithStr("%")) {
         if (!tok->astOperand2() || !tok->astOperand1())
             continue;
-        if (tok->str() != "%")
-            continue;
         if (!tok->valueType() || !tok->valueType()->isIntegral())
             continue;
 
@@ -43,6 +43,11 @@ namespace {
 static const struct CWE CWE398(398U);   // Indicator of Poor Code Quality
 
 
+bool CheckPostfixOperator::canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const
+{
+    return tokenizer->isCPP() && settings->severity.isEnabled(Severity::performance);
+}
+
 void CheckPostfixOperator::postfixOperator()
 {
     if (!mSettings->severity.isEnabled(Severity::performance))
@@ -56,6 +56,8 @@ public:
         checkPostfixOperator.postfixOperator();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings *settings) const override;
+
     /** Check postfix operators */
     void postfixOperator();
 
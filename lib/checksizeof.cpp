@@ -282,10 +282,13 @@ void CheckSizeof::sizeofsizeof()
     if (!mSettings->severity.isEnabled(Severity::warning))
         return;
 
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
+    const Token *skip = nullptr;
+    for (const Token *tok : mTokenizer->tokensWithStr("sizeof")) {
+        if (tok == skip)
+            continue;
         if (Token::Match(tok, "sizeof (| sizeof")) {
             sizeofsizeofError(tok);
-            tok = tok->next();
+            skip = tok->next();
         }
     }
 }
@@ -308,7 +311,7 @@ void CheckSizeof::sizeofCalculation()
 
     const bool printInconclusive = mSettings->certainty.isEnabled(Certainty::inconclusive);
 
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
+    for (const Token *tok : mTokenizer->tokensWithStr("sizeof")) {
         if (!Token::simpleMatch(tok, "sizeof ("))
             continue;
 
@@ -350,7 +353,7 @@ void CheckSizeof::sizeofFunction()
     if (!mSettings->severity.isEnabled(Severity::warning))
         return;
 
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
+    for (const Token *tok : mTokenizer->tokensWithStr("sizeof")) {
         if (Token::simpleMatch(tok, "sizeof (")) {
 
             // ignore if the `sizeof` result is cast to void inside a macro, i.e. the calculation is
@@ -391,7 +394,7 @@ void CheckSizeof::suspiciousSizeofCalculation()
     if (!mSettings->severity.isEnabled(Severity::warning) || !mSettings->certainty.isEnabled(Certainty::inconclusive))
         return;
 
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
+    for (const Token *tok : mTokenizer->tokensWithStr("sizeof")) {
         if (Token::simpleMatch(tok, "sizeof (")) {
             const Token* lPar = tok->astParent();
             if (lPar && lPar->str() == "(") {
@@ -87,6 +87,10 @@ public:
         checkStl.size();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings * /*settings*/) const override {
+        return tokenizer->isCPP();
+    }
+
     /** Accessing container out of bounds using ValueFlow */
     void outOfBounds();
 
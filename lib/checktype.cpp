@@ -316,8 +316,8 @@ void CheckType::checkLongCast()
         return;
 
     // Assignments..
-    for (const Token *tok = mTokenizer->tokens(); tok; tok = tok->next()) {
-        if (tok->str() != "=" || !Token::Match(tok->astOperand2(), "*|<<") || tok->astOperand2()->isUnaryOp("*"))
+    for (const Token *tok : mTokenizer->tokensWithStr("=")) {
+        if (!Token::Match(tok->astOperand2(), "*|<<") || tok->astOperand2()->isUnaryOp("*"))
             continue;
 
         if (tok->astOperand2()->hasKnownIntValue()) {
@@ -173,14 +173,14 @@ void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string>
             }
             if (!init) {
                 Alloc alloc = ARRAY;
-                const std::map<nonneg int, VariableValue> variableValue;
+                std::map<nonneg int, VariableValue> variableValue;
                 checkScopeForVariable(tok, var, nullptr, nullptr, &alloc, emptyString, variableValue);
             }
             continue;
         }
         if (stdtype || var.isPointer()) {
             Alloc alloc = NO_ALLOC;
-            const std::map<nonneg int, VariableValue> variableValue;
+            std::map<nonneg int, VariableValue> variableValue;
             checkScopeForVariable(tok, var, nullptr, nullptr, &alloc, emptyString, variableValue);
         }
         if (var.type())
@@ -205,7 +205,7 @@ void CheckUninitVar::checkScope(const Scope* scope, const std::set<std::string>
                         checkStruct(tok, arg);
                     else if (arg.typeStartToken()->isStandardType() || arg.typeStartToken()->isEnumType()) {
                         Alloc alloc = NO_ALLOC;
-                        const std::map<nonneg int, VariableValue> variableValue;
+                        std::map<nonneg int, VariableValue> variableValue;
                         checkScopeForVariable(tok->next(), arg, nullptr, nullptr, &alloc, emptyString, variableValue);
                     }
                 }
@@ -244,7 +244,7 @@ void CheckUninitVar::checkStruct(const Token *tok, const Variable &structvar)
                     const Token *tok2 = tok;
                     if (tok->str() == "}")
                         tok2 = tok2->next();
-                    const std::map<nonneg int, VariableValue> variableValue;
+                    std::map<nonneg int, VariableValue> variableValue;
                     checkScopeForVariable(tok2, structvar, nullptr, nullptr, &alloc, var.name(), variableValue);
                 }
             }
@@ -313,9 +313,9 @@ static void conditionAlwaysTrueOrFalse(const Token *tok, const std::map<nonneg i
             return;
 
         if (tok->str() == "==")
-            *alwaysTrue  = (it->second == MathLib::toLongNumber(numtok->str()));
+            *alwaysTrue  = (it->second == numtok->toLongNumber());
         else if (tok->str() == "!=")
-            *alwaysTrue  = (it->second != MathLib::toLongNumber(numtok->str()));
+            *alwaysTrue  = (it->second != numtok->toLongNumber());
         else
             return;
         *alwaysFalse = !(*alwaysTrue);
@@ -375,8 +375,66 @@ static bool isVariableUsed(const Token *tok, const Variable& var)
     return !parent2 || parent2->isConstOp() || (parent2->str() == "=" && parent2->astOperand2() == parent);
 }
 
-bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var, bool * const possibleInit, bool * const noreturn, Alloc* const alloc, const std::string &membervar, std::map<nonneg int, VariableValue> variableValue)
+namespace {
+    /**
+     * Changes the known values of the variables in a scope. The old values are
+     * restored when the scope is left, so inner scopes can share the map of the
+     * outer scope instead of copying it.
+     */
+    class VariableValueChanges {
+    public:
+        explicit VariableValueChanges(std::map<nonneg int, VariableValue> &variableValue) : mVariableValue(variableValue) {}
+
+        ~VariableValueChanges() {
+            for (const std::pair<const nonneg int, std::pair<bool, VariableValue>> &old : mOldValues) {
+                if (old.second.first)
+                    mVariableValue[old.first] = old.second.second;
+                else
+                    mVariableValue.erase(old.first);
+            }
+        }
+
+        VariableValueChanges(const VariableValueChanges &) = delete;
+        VariableValueChanges &operator=(const VariableValueChanges &) = delete;
+
+        void set(nonneg int varid, const VariableValue &value) {
+            save(varid);
+            mVariableValue[varid] = value;
+        }
+
+        void erase(nonneg int varid) {
+            save(varid);
+            mVariableValue.erase(varid);
+        }
+
+        /** set the values that are not known yet */
+        void insert(const std::map<nonneg int, VariableValue> &values) {
+            for (const std::pair<const nonneg int, VariableValue> &value : values) {
+                if (mVariableValue.find(value.first) == mVariableValue.end())
+                    set(value.first, value.second);
+            }
+        }
+
+    private:
+        void save(nonneg int varid) {
+            if (mOldValues.find(varid) != mOldValues.end())
+                return;
+            const std::map<nonneg int, VariableValue>::const_iterator it = mVariableValue.find(varid);
+            if (it == mVariableValue.end())
+                mOldValues.emplace(varid, std::make_pair(false, VariableValue()));
+            else
+                mOldValues.emplace(varid, std::make_pair(true, it->second));
+        }
+
+        std::map<nonneg int, VariableValue> &mVariableValue;
+        std::map<nonneg int, std::pair<bool, VariableValue>> mOldValues;
+    };
+}
+
+bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var, bool * const possibleInit, bool * const noreturn, Alloc* const alloc, const std::string &membervar, std::map<nonneg int, VariableValue> &variableValue)
 {
+    VariableValueChanges changes(variableValue);
+
     const bool suppressErrors(possibleInit && *possibleInit);  // Assume that this is a variable declaration, rather than a fundef
     const bool printDebug = mSettings->debugwarnings;
 
@@ -421,11 +479,11 @@ bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var
         // track values of other variables..
         if (Token::Match(tok->previous(), "[;{}] %var% =")) {
             if (tok->next()->astOperand2() && tok->next()->astOperand2()->hasKnownIntValue())
-                variableValue[tok->varId()] = VariableValue(tok->next()->astOperand2()->getKnownIntValue());
+                changes.set(tok->varId(), VariableValue(tok->next()->astOperand2()->getKnownIntValue()));
             else if (Token::Match(tok->previous(), "[;{}] %var% = - %name% ;"))
-                variableValue[tok->varId()] = !VariableValue(0);
+                changes.set(tok->varId(), !VariableValue(0));
             else
-                variableValue.erase(tok->varId());
+                changes.erase(tok->varId());
         }
 
         // Inner scope..
@@ -515,12 +573,12 @@ bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var
                         if (Token::Match(tok2, "[;{}.] %name% = - %name% ;"))
                             varValueIf[tok2->next()->varId()] = !VariableValue(0);
                         else if (Token::Match(tok2, "[;{}.] %name% = %num% ;"))
-                            varValueIf[tok2->next()->varId()] = VariableValue(MathLib::toLongNumber(tok2->strAt(3)));
+                            varValueIf[tok2->next()->varId()] = VariableValue(tok2->tokAt(3)->toLongNumber());
                     }
                 }
 
                 if (initif && condVarId > 0)
-                    variableValue[condVarId] = !condVarValue;
+                    changes.set(condVarId, !condVarValue);
 
                 // goto the }
                 tok = tok->link();
@@ -545,12 +603,12 @@ bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var
                             if (Token::Match(tok2, "[;{}.] %var% = - %name% ;"))
                                 varValueElse[tok2->next()->varId()] = !VariableValue(0);
                             else if (Token::Match(tok2, "[;{}.] %var% = %num% ;"))
-                                varValueElse[tok2->next()->varId()] = VariableValue(MathLib::toLongNumber(tok2->strAt(3)));
+                                varValueElse[tok2->next()->varId()] = VariableValue(tok2->tokAt(3)->toLongNumber());
                         }
                     }
 
                     if (initelse && condVarId > 0 && !noreturnIf && !noreturnElse)
-                        variableValue[condVarId] = condVarValue;
+                        changes.set(condVarId, condVarValue);
 
                     // goto the }
                     tok = tok->link();
@@ -562,9 +620,9 @@ bool CheckUninitVar::checkScopeForVariable(const Token *tok, const Variable& var
                     if (initif || initelse || possibleInitElse)
                         ++number_of_if;
                     if (!initif && !noreturnIf)
-                        variableValue.insert(varValueIf.cbegin(), varValueIf.cend());
+                        changes.insert(varValueIf);
                     if (!initelse && !noreturnElse)
-                        variableValue.insert(varValueElse.cbegin(), varValueElse.cend());
+                        changes.insert(varValueElse);
                 }
             }
         }
@@ -24,13 +24,13 @@
 
 #include "check.h"
 #include "config.h"
+#include "tokenize.h"
 
 #include <string>
 
 class ErrorLogger;
 class Settings;
 class Token;
-class Tokenizer;
 
 /// @addtogroup Checks
 /// @{
@@ -52,6 +52,10 @@ public:
         check.va_list_usage();
     }
 
+    bool canRunChecks(const Tokenizer *tokenizer, const Settings * /*settings*/) const override {
+        return !tokenizer->tokensWithStr("va_start").empty() || !tokenizer->tokensWithStr("va_list").empty();
+    }
+
     void va_start_argument();
     void va_list_usage();
 
@@ -48,6 +48,8 @@
 #include <exception>
 #include <fstream>
 #include <iostream> // <- TEMPORARY
+#include <map>
+#include <mutex>
 #include <new>
 #include <set>
 #include <sstream> // IWYU pragma: keep
@@ -1094,6 +1096,12 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
         if (doUnusedFunctionOnly && dynamic_cast<CheckUnusedFunctions*>(check) == nullptr)
             continue;
 
+        if (!check->canRunChecks(&tokenizer, &mSettings)) {
+            if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_SUMMARY || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TOP5)
+                s_timerResults.addSkipped(check->name() + "::runChecks");
+            continue;
+        }
+
         Timer timerRunChecks(check->name() + "::runChecks", mSettings.showtime, &s_timerResults);
         check->runChecks(&tokenizer, &mSettings, this);
     }
@@ -1272,17 +1280,94 @@ static const char * pcreErrorCodeToString(const int pcreExecRet)
     return "";
 }
 
+namespace {
+    /** Compiled form of a rule pattern, shared by all CppCheck instances */
+    struct CompiledRule {
+        CompiledRule() = default;
+        CompiledRule(const CompiledRule &) = delete;
+        CompiledRule &operator=(const CompiledRule &) = delete;
+        ~CompiledRule() {
+            if (re)
+                pcre_free(re);
+#ifdef PCRE_CONFIG_JIT
+            // Free up the EXTRA PCRE value (may be NULL at this point)
+            if (extra)
+                pcre_free_study(extra);
+#endif
+        }
+
+        pcre *re{};
+        pcre_extra *extra{};
+        /** error reported by pcre_compile() / pcre_study() */
+        std::string error;
+        std::string errorId;
+        /** text that every match of the pattern contains, empty if unknown */
+        std::string literal;
+    };
+}
+
+/** Compile the given pattern, or get it from the cache if it is already compiled */
+static const CompiledRule &getCompiledRule(const std::string &pattern)
+{
+    static std::map<std::string, CompiledRule> compiledRules;
+    static std::mutex compiledRulesSync;
+
+    std::lock_guard<std::mutex> lg(compiledRulesSync);
+    const std::map<std::string, CompiledRule>::iterator it = compiledRules.find(pattern);
+    if (it != compiledRules.end())
+        return it->second;
+
+    CompiledRule &rule = compiledRules[pattern];
+
+    const char *pcreCompileErrorStr = nullptr;
+    int erroffset = 0;
+    rule.re = pcre_compile(pattern.c_str(),0,&pcreCompileErrorStr,&erroffset,nullptr);
+    if (!rule.re) {
+        if (pcreCompileErrorStr) {
+            rule.error = "pcre_compile failed: " + std::string(pcreCompileErrorStr);
+            rule.errorId = "pcre_compile";
+        }
+        return rule;
+    }
+
+    // Optimize the regex, but only if PCRE_CONFIG_JIT is available
+#ifdef PCRE_CONFIG_JIT
+    const char *pcreStudyErrorStr = nullptr;
+    rule.extra = pcre_study(rule.re, PCRE_STUDY_JIT_COMPILE, &pcreStudyErrorStr);
+    // pcre_study() returns NULL for both errors and when it can not optimize the regex.
+    // The last argument is how one checks for errors.
+    // It is NULL if everything works, and points to an error string otherwise.
+    if (pcreStudyErrorStr) {
+        rule.error = "pcre_study failed: " + std::string(pcreStudyErrorStr);
+        rule.errorId = "pcre_study";
+        // pcre_compile() worked, but pcre_study() returned an error. Free the resources allocated by pcre_compile().
+        pcre_free(rule.re);
+        rule.re = nullptr;
+        return rule;
+    }
+#endif
+
+    rule.literal = getRequiredLiteral(pattern);
+    return rule;
+}
+
 void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &tokenizer)
 {
     // There is no rule to execute
     if (!hasRule(tokenlist))
         return;
 
-    // Write all tokens in a string that can be parsed by pcre
-    std::ostringstream ostr;
-    for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next())
-        ostr << " " << tok->str();
-    const std::string str(ostr.str());
+    // Write all tokens in a string that can be parsed by pcre.
+    // tokenEnds[i] is the offset after the i:th token in the string.
+    std::string str;
+    std::vector<std::size_t> tokenEnds;
+    std::vector<const Token *> tokens;
+    for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
+        str += ' ';
+        str += tok->str();
+        tokenEnds.push_back(str.size());
+        tokens.push_back(tok);
+    }
 
     for (const Settings::Rule &rule : mSettings.rules) {
         if (rule.pattern.empty() || rule.id.empty() || rule.severity == Severity::none || rule.tokenlist != tokenlist)
@@ -1292,17 +1377,14 @@ void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &token
             reportOut("Processing rule: " + rule.pattern, Color::FgGreen);
         }
 
-        const char *pcreCompileErrorStr = nullptr;
-        int erroffset = 0;
-        pcre * const re = pcre_compile(rule.pattern.c_str(),0,&pcreCompileErrorStr,&erroffset,nullptr);
-        if (!re) {
-            if (pcreCompileErrorStr) {
-                const std::string msg = "pcre_compile failed: " + std::string(pcreCompileErrorStr);
+        const CompiledRule &compiledRule = getCompiledRule(rule.pattern);
+        if (!compiledRule.re) {
+            if (!compiledRule.error.empty()) {
                 const ErrorMessage errmsg(std::list<ErrorMessage::FileLocation>(),
                                           emptyString,
                                           Severity::error,
-                                          msg,
-                                          "pcre_compile",
+                                          compiledRule.error,
+                                          compiledRule.errorId,
                                           Certainty::normal);
 
                 reportErr(errmsg);
@@ -1310,35 +1392,14 @@ void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &token
             continue;
         }
 
-        // Optimize the regex, but only if PCRE_CONFIG_JIT is available
-#ifdef PCRE_CONFIG_JIT
-        const char *pcreStudyErrorStr = nullptr;
-        pcre_extra * const pcreExtra = pcre_study(re, PCRE_STUDY_JIT_COMPILE, &pcreStudyErrorStr);
-        // pcre_study() returns NULL for both errors and when it can not optimize the regex.
-        // The last argument is how one checks for errors.
-        // It is NULL if everything works, and points to an error string otherwise.
-        if (pcreStudyErrorStr) {
-            const std::string msg = "pcre_study failed: " + std::string(pcreStudyErrorStr);
-            const ErrorMessage errmsg(std::list<ErrorMessage::FileLocation>(),
-                                      emptyString,
-                                      Severity::error,
-                                      msg,
-                                      "pcre_study",
-                                      Certainty::normal);
-
-            reportErr(errmsg);
-            // pcre_compile() worked, but pcre_study() returned an error. Free the resources allocated by pcre_compile().
-            pcre_free(re);
+        // The pattern can't match if the text it requires is not there
+        if (!compiledRule.literal.empty() && str.find(compiledRule.literal) == std::string::npos)
             continue;
-        }
-#else
-        const pcre_extra * const pcreExtra = nullptr;
-#endif
 
         int pos = 0;
         int ovector[30]= {0};
         while (pos < (int)str.size()) {
-            const int pcreExecRet = pcre_exec(re, pcreExtra, str.c_str(), (int)str.size(), pos, 0, ovector, 30);
+            const int pcreExecRet = pcre_exec(compiledRule.re, compiledRule.extra, str.c_str(), (int)str.size(), pos, 0, ovector, 30);
             if (pcreExecRet < 0) {
                 const std::string errorMessage = pcreErrorCodeToString(pcreExecRet);
                 if (!errorMessage.empty()) {
@@ -1364,14 +1425,11 @@ void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &token
             loc.setfile(tokenizer.list.getSourceFilePath());
             loc.line = 0;
 
-            std::size_t len = 0;
-            for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
-                len = len + 1U + tok->str().size();
-                if (len > pos1) {
-                    loc.setfile(tokenizer.list.getFiles().at(tok->fileIndex()));
-                    loc.line = tok->linenr();
-                    break;
-                }
+            const std::vector<std::size_t>::const_iterator end = std::upper_bound(tokenEnds.cbegin(), tokenEnds.cend(), pos1);
+            if (end != tokenEnds.cend()) {
+                const Token *tok = tokens[end - tokenEnds.cbegin()];
+                loc.setfile(tokenizer.list.getFiles().at(tok->fileIndex()));
+                loc.line = tok->linenr();
             }
 
             const std::list<ErrorMessage::FileLocation> callStack(1, loc);
@@ -1387,14 +1445,6 @@ void CppCheck::executeRules(const std::string &tokenlist, const Tokenizer &token
             // Report error
             reportErr(errmsg);
         }
-
-        pcre_free(re);
-#ifdef PCRE_CONFIG_JIT
-        // Free up the EXTRA PCRE value (may be NULL at this point)
-        if (pcreExtra) {
-            pcre_free_study(pcreExtra);
-        }
-#endif
     }
 }
 #endif
@@ -1627,6 +1677,94 @@ void CppCheck::reportProgress(const std::string &filename, const char stage[], c
     mErrorLogger.reportProgress(filename, stage, value);
 }
 
+std::string CppCheck::getRequiredLiteral(const std::string &pattern)
+{
+    // alternatives and most (?..) constructs make the literals optional
+    if (pattern.find('|') != std::string::npos)
+        return "";
+    for (std::string::size_type pos = pattern.find("(?"); pos != std::string::npos; pos = pattern.find("(?", pos + 1)) {
+        if (pattern.compare(pos, 3, "(?:") != 0)
+            return "";
+    }
+
+    std::string best;
+    std::string current;
+    const auto endRun = [&]() {
+        if (current.size() > best.size())
+            best = current;
+        current.clear();
+    };
+
+    int depth = 0;
+    for (std::string::size_type i = 0; i < pattern.size(); ++i) {
+        const char c = pattern[i];
+        if (c == '\\') {
+            if (i + 1 >= pattern.size())
+                return "";
+            const char e = pattern[++i];
+            if (std::isalnum(static_cast<unsigned char>(e))) {
+                // only character types and assertions are known to be single items
+                if (std::strchr("wWdDsSbB", e) == nullptr)
+                    return "";
+                endRun();
+            } else if (depth == 0) {
+                current += e;
+            }
+        } else if (c == '[') {
+            endRun();
+            // skip the character class, a leading ']' is a literal
+            ++i;
+            if (i < pattern.size() && pattern[i] == '^')
+                ++i;
+            if (i < pattern.size() && pattern[i] == ']')
+                ++i;
+            while (i < pattern.size() && pattern[i] != ']') {
+                if (pattern[i] == '\\') {
+                    // \Q..\E may hide the closing bracket
+                    if (i + 1 < pattern.size() && pattern[i + 1] == 'Q')
+                        return "";
+                    i += 2;
+                } else if (pattern[i] == '[' && i + 1 < pattern.size() && std::strchr(":=.", pattern[i + 1])) {
+                    // POSIX class such as [:alpha:], [=a=] or [.a.]
+                    const std::string close{pattern[i + 1], ']'};
+                    const std::string::size_type end = pattern.find(close, i + 2);
+                    if (end == std::string::npos)
+                        return "";
+                    i = end + 2;
+                } else {
+                    ++i;
+                }
+            }
+            if (i >= pattern.size())
+                return "";
+        } else if (c == '(') {
+            endRun();
+            ++depth;
+        } else if (c == ')') {
+            endRun();
+            if (depth == 0)
+                return "";
+            --depth;
+        } else if (c == '*' || c == '?' || c == '{') {
+            // the previous item is optional
+            if (!current.empty())
+                current.pop_back();
+            endRun();
+            if (c == '{') {
+                i = pattern.find('}', i);
+                if (i == std::string::npos)
+                    return "";
+            }
+        } else if (c == '+' || c == '.' || c == '^' || c == '$') {
+            endRun();
+        } else if (depth == 0) {
+            current += c;
+        }
+    }
+    endRun();
+    return best;
+}
+
 void CppCheck::getErrorMessages(ErrorLogger &errorlogger)
 {
     Settings s;
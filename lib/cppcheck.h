@@ -118,6 +118,13 @@ public:
      */
     static void getErrorMessages(ErrorLogger &errorlogger);
 
+    /**
+     * @brief Find a literal text that every match of a rule pattern must contain.
+     * Only simple patterns are handled; an empty string is returned when it is
+     * not certain that the literal is required.
+     */
+    static std::string getRequiredLiteral(const std::string &pattern);
+
     void tooManyConfigsError(const std::string &file, const int numberOfConfigurations);
     void purgedConfigurationMessage(const std::string &file, const std::string& configuration);
 
@@ -18,6 +18,8 @@
 
 #include "errortypes.h"
 
+const std::list<ErrorPathItem> ErrorPath::mEmpty;
+
 InternalError::InternalError(const Token *tok, std::string errorMsg, Type type) :
     token(tok), errorMessage(std::move(errorMsg)), type(type)
 {
@@ -23,8 +23,11 @@
 
 #include "config.h"
 
-#include <stdexcept>
+#include <initializer_list>
+#include <iterator>
 #include <list>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <utility>
 
@@ -123,7 +126,150 @@ struct CWE {
 };
 
 using ErrorPathItem = std::pair<const Token *, std::string>;
-using ErrorPath = std::list<ErrorPathItem>;
+
+/**
+ * @brief List of error path items with copy-on-write storage.
+ *
+ * ValueFlow values are copied to every token they flow to, and each copy
+ * carries its error path. Copies share the items until one of them is
+ * modified, so the path is stored once instead of once per token.
+ */
+class CPPCHECKLIB ErrorPath {
+    using List = std::list<ErrorPathItem>;
+public:
+    using value_type = ErrorPathItem;
+    using reference = ErrorPathItem&;
+    using const_reference = const ErrorPathItem&;
+    using iterator = List::iterator;
+    using const_iterator = List::const_iterator;
+    using size_type = List::size_type;
+
+    ErrorPath() = default;
+    ErrorPath(std::initializer_list<ErrorPathItem> items) {
+        if (items.size() > 0)
+            mItems = std::make_shared<List>(items);
+    }
+    template<class InputIt>
+    ErrorPath(InputIt first, InputIt last) {
+        if (first != last)
+            mItems = std::make_shared<List>(first, last);
+    }
+
+    const_iterator begin() const {
+        return items().cbegin();
+    }
+    const_iterator end() const {
+        return items().cend();
+    }
+    const_iterator cbegin() const {
+        return items().cbegin();
+    }
+    const_iterator cend() const {
+        return items().cend();
+    }
+    iterator begin() {
+        return unshare().begin();
+    }
+    iterator end() {
+        return unshare().end();
+    }
+
+    bool empty() const {
+        return !mItems || mItems->empty();
+    }
+    size_type size() const {
+        return mItems ? mItems->size() : 0;
+    }
+
+    const ErrorPathItem& front() const {
+        return items().front();
+    }
+    const ErrorPathItem& back() const {
+        return items().back();
+    }
+    ErrorPathItem& front() {
+        return unshare().front();
+    }
+    ErrorPathItem& back() {
+        return unshare().back();
+    }
+
+    template<class... Args>
+    void emplace_back(Args&&... args) {
+        unshare().emplace_back(std::forward<Args>(args)...);
+    }
+    template<class... Args>
+    void emplace_front(Args&&... args) {
+        unshare().emplace_front(std::forward<Args>(args)...);
+    }
+    void push_back(ErrorPathItem item) {
+        unshare().push_back(std::move(item));
+    }
+    void push_front(ErrorPathItem item) {
+        unshare().push_front(std::move(item));
+    }
+
+    iterator insert(const_iterator pos, ErrorPathItem item) {
+        const iterator it = unshare(pos);
+        return mItems->insert(it, std::move(item));
+    }
+    template<class InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last) {
+        const iterator it = unshare(pos);
+        return mItems->insert(it, first, last);
+    }
+    iterator erase(const_iterator pos) {
+        const iterator it = unshare(pos);
+        return mItems->erase(it);
+    }
+    template<class Predicate>
+    void remove_if(Predicate pred) {
+        if (!empty())
+            unshare().remove_if(pred);
+    }
+    void splice(const_iterator pos, ErrorPath &other) {
+        if (other.empty())
+            return;
+        const iterator it = unshare(pos);
+        mItems->splice(it, other.unshare());
+    }
+    void clear() {
+        mItems.reset();
+    }
+
+    friend bool operator==(const ErrorPath &lhs, const ErrorPath &rhs) {
+        return lhs.mItems == rhs.mItems || lhs.items() == rhs.items();
+    }
+    friend bool operator!=(const ErrorPath &lhs, const ErrorPath &rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    const List& items() const {
+        return mItems ? *mItems : mEmpty;
+    }
+
+    /** Make sure this path owns its items before modifying them */
+    List& unshare() {
+        if (!mItems)
+            mItems = std::make_shared<List>();
+        else if (mItems.use_count() > 1)
+            mItems = std::make_shared<List>(*mItems);
+        return *mItems;
+    }
+
+    /** Like unshare(), and translate an iterator into the old items to the new ones */
+    iterator unshare(const_iterator pos) {
+        if (mItems && mItems.use_count() == 1)
+            return mItems->erase(pos, pos);
+        const auto index = std::distance(items().cbegin(), pos);
+        List &list = unshare();
+        return std::next(list.begin(), index);
+    }
+
+    std::shared_ptr<List> mItems;
+    static const List mEmpty;
+};
 
 /// @}
 //---------------------------------------------------------------------------
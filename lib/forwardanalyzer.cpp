@@ -60,6 +60,21 @@ struct ForwardTraversal {
     bool analyzeTerminate{};
     Analyzer::Terminate terminate = Analyzer::Terminate::None;
     std::vector<Token*> loopEnds;
+    // Function whose forward budget is used, shared with forks. No limit if null.
+    const Scope* budgetScope{};
+
+    // Use n tokens of the budget, returns false when the budget has run out
+    bool useBudget(std::size_t n) const {
+        if (!budgetScope)
+            return true;
+        if (budgetScope->forwardBudget < n) {
+            budgetScope->forwardBudget = 0;
+            budgetScope->forwardBudgetExceeded = true;
+            return false;
+        }
+        budgetScope->forwardBudget -= n;
+        return true;
+    }
 
     Progress Break(Analyzer::Terminate t = Analyzer::Terminate::None) {
         if ((!analyzeOnly || analyzeTerminate) && t != Analyzer::Terminate::None)
@@ -228,6 +243,8 @@ struct ForwardTraversal {
     }
 
     Progress update(Token* tok) {
+        if (!useBudget(1))
+            return Break(Analyzer::Terminate::Bail);
         Analyzer::Action action = analyzer->analyze(tok, Analyzer::Direction::Forward);
         actions |= action;
         if (!action.isNone() && !analyzeOnly)
@@ -544,6 +561,14 @@ struct ForwardTraversal {
                 throw InternalError(tok, "Cyclic forward analysis.");
             i = tok->index();
 
+            // Skip statements that can not affect the analysis
+            if (Token* stmtEnd = findIndependentStatementEnd(tok, end)) {
+                if (!useBudget(stmtEnd->index() - tok->index()))
+                    return Break(Analyzer::Terminate::Bail);
+                tok = stmtEnd->previous();
+                continue;
+            }
+
             if (tok->link()) {
                 // Skip casts..
                 if (tok->str() == "(" && !tok->astOperand2() && tok->isCast()) {
@@ -825,6 +850,31 @@ struct ForwardTraversal {
         return Progress::Continue;
     }
 
+    // Find the end of an expression statement that starts at tok, has no control flow and
+    // can not affect the analysis. The scan stops at the first token that matters.
+    Token* findIndependentStatementEnd(Token* tok, const Token* end) const {
+        if (!Token::Match(tok->previous(), "[;{}]"))
+            return nullptr;
+        int depth = 0;
+        for (Token* tok2 = tok; precedes(tok2, end); tok2 = tok2->next()) {
+            if (tok2->str() == ";")
+                return depth == 0 && tok2 != tok ? tok2 : nullptr;
+            if (!analyzer->isIndependent(tok2))
+                return nullptr;
+            if (Token::Match(tok2, "(|["))
+                ++depth;
+            else if (Token::Match(tok2, ")|]") && --depth < 0)
+                return nullptr;
+            else if (Token::Match(tok2, "{|}|?|:|&&|%oror%|throw|asm|try|default|setjmp|longjmp|assert|ASSERT"))
+                return nullptr;
+            else if (tok2->isControlFlowKeyword())
+                return nullptr;
+            else if (Token::Match(tok2, "%name% (") && isEscapeFunction(tok2, &settings.library))
+                return nullptr;
+        }
+        return nullptr;
+    }
+
     static bool isUnevaluated(const Token* tok) {
         return Token::Match(tok->previous(), "sizeof|decltype (");
     }
@@ -895,11 +945,23 @@ struct ForwardTraversal {
     }
 };
 
+// All forward analysis in a function shares the budget of the function
+static const Scope* getBudgetScope(const Token* start)
+{
+    if (!start || !start->scope())
+        return nullptr;
+    const Function* f = Scope::nestedInFunction(start->scope());
+    if (!f || !f->functionScope || !f->functionScope->hasForwardBudget)
+        return nullptr;
+    return f->functionScope;
+}
+
 Analyzer::Result valueFlowGenericForward(Token* start, const Token* end, const ValuePtr<Analyzer>& a, const Settings& settings)
 {
     if (a->invalid())
         return Analyzer::Result{Analyzer::Action::None, Analyzer::Terminate::Bail};
     ForwardTraversal ft{a, settings};
+    ft.budgetScope = getBudgetScope(start);
     ft.updateRange(start, end);
     return Analyzer::Result{ ft.actions, ft.terminate };
 }
@@ -911,6 +973,7 @@ Analyzer::Result valueFlowGenericForward(Token* start, const ValuePtr<Analyzer>&
     if (a->invalid())
         return Analyzer::Result{Analyzer::Action::None, Analyzer::Terminate::Bail};
     ForwardTraversal ft{a, settings};
+    ft.budgetScope = getBudgetScope(start);
     ft.updateRecursive(start);
     return Analyzer::Result{ ft.actions, ft.terminate };
 }
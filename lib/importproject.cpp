@@ -49,25 +49,22 @@ ImportProject::ImportProject()
 
 void ImportProject::ignorePaths(const std::vector<std::string> &ipaths)
 {
+    // Prepare the paths once instead of for every file
+    std::vector<std::string> prefixes;
+    std::vector<std::string> globs;
+    for (const std::string &i : ipaths) {
+        prefixes.push_back(i);
+        if (isValidGlobPattern(i))
+            globs.push_back(i);
+        if (!Path::isAbsolute(i))
+            prefixes.push_back(mPath + i);
+    }
+
     for (std::list<FileSettings>::iterator it = fileSettings.begin(); it != fileSettings.end();) {
-        bool ignore = false;
-        for (std::string i : ipaths) {
-            if (it->filename.size() > i.size() && it->filename.compare(0,i.size(),i)==0) {
-                ignore = true;
-                break;
-            }
-            if (isValidGlobPattern(i) && matchglob(i, it->filename)) {
-                ignore = true;
-                break;
-            }
-            if (!Path::isAbsolute(i)) {
-                i = mPath + i;
-                if (it->filename.size() > i.size() && it->filename.compare(0,i.size(),i)==0) {
-                    ignore = true;
-                    break;
-                }
-            }
-        }
+        const std::string &filename = it->filename;
+        const bool ignore = std::any_of(prefixes.cbegin(), prefixes.cend(), [&](const std::string &prefix) {
+            return filename.size() > prefix.size() && filename.compare(0, prefix.size(), prefix) == 0;
+        }) || matchglobs(globs, filename);
         if (ignore)
             it = fileSettings.erase(it);
         else
@@ -83,9 +83,18 @@ Library::Error Library::load(const char exename[], const char path[])
     }
 
     std::string absolute_path;
-    // open file..
+    bool alreadyLoaded = false;
+    // open file.. a file that is already loaded is not read and parsed again
     tinyxml2::XMLDocument doc;
-    tinyxml2::XMLError error = doc.LoadFile(path);
+    const auto loadFile = [&](const std::string &filename) {
+        absolute_path = Path::getAbsoluteFilePath(filename);
+        if (!absolute_path.empty() && mFiles.find(absolute_path) != mFiles.end()) {
+            alreadyLoaded = true;
+            return tinyxml2::XML_SUCCESS;
+        }
+        return doc.LoadFile(filename.c_str());
+    };
+    tinyxml2::XMLError error = loadFile(path);
     if (error == tinyxml2::XML_ERROR_FILE_READ_ERROR && Path::getFilenameExtension(path).empty())
         // Reading file failed, try again...
         error = tinyxml2::XML_ERROR_FILE_NOT_FOUND;
@@ -94,9 +103,7 @@ Library::Error Library::load(const char exename[], const char path[])
         std::string fullfilename(path);
         if (Path::getFilenameExtension(fullfilename).empty()) {
             fullfilename += ".cfg";
-            error = doc.LoadFile(fullfilename.c_str());
-            if (error != tinyxml2::XML_ERROR_FILE_NOT_FOUND)
-                absolute_path = Path::getAbsoluteFilePath(fullfilename);
+            error = loadFile(fullfilename);
         }
 
         std::list<std::string> cfgfolders;
@@ -115,15 +122,12 @@ Library::Error Library::load(const char exename[], const char path[])
             cfgfolders.pop_back();
             const char *sep = (!cfgfolder.empty() && endsWith(cfgfolder,'/') ? "" : "/");
             const std::string filename(cfgfolder + sep + fullfilename);
-            error = doc.LoadFile(filename.c_str());
-            if (error != tinyxml2::XML_ERROR_FILE_NOT_FOUND)
-                absolute_path = Path::getAbsoluteFilePath(filename);
+            error = loadFile(filename);
         }
-    } else
-        absolute_path = Path::getAbsoluteFilePath(path);
+    }
 
     if (error == tinyxml2::XML_SUCCESS) {
-        if (mFiles.find(absolute_path) == mFiles.end()) {
+        if (!alreadyLoaded && mFiles.find(absolute_path) == mFiles.end()) {
             Error err = load(doc);
             if (err.errorcode == ErrorCode::OK)
                 mFiles.insert(absolute_path);
@@ -1003,6 +1007,18 @@ std::string Library::getFunctionName(const Token *ftok, bool &error) const
 }
 
 std::string Library::getFunctionName(const Token *ftok) const
+{
+    TokenImpl::LibraryFunction * const cache = ftok->libraryFunction(this);
+    if (!cache)
+        return findFunctionName(ftok);
+    if (!cache->hasFunctionName) {
+        cache->functionName = findFunctionName(ftok);
+        cache->hasFunctionName = true;
+    }
+    return cache->functionName;
+}
+
+std::string Library::findFunctionName(const Token *ftok) const
 {
     if (!Token::Match(ftok, "%name% )| (") && (ftok->strAt(-1) != "&" || ftok->previous()->astOperand2()))
         return "";
@@ -1247,6 +1263,18 @@ bool Library::isContainerYield(const Token * const cond, Library::Container::Yie
 
 // returns true if ftok is not a library function
 bool Library::isNotLibraryFunction(const Token *ftok) const
+{
+    TokenImpl::LibraryFunction * const cache = ftok->libraryFunction(this);
+    if (!cache)
+        return findIsNotLibraryFunction(ftok);
+    if (!cache->hasNotLibraryFunction) {
+        cache->notLibraryFunction = findIsNotLibraryFunction(ftok);
+        cache->hasNotLibraryFunction = true;
+    }
+    return cache->notLibraryFunction;
+}
+
+bool Library::findIsNotLibraryFunction(const Token *ftok) const
 {
     if (ftok->isKeyword() || ftok->isStandardType())
         return true;
@@ -507,7 +507,7 @@ public:
     }
 
     /**
-     * Get function name for function call
+     * Get function name for function call. The result is cached in the token when the token list is final.
      */
     std::string getFunctionName(const Token *ftok) const;
 
@@ -610,6 +610,10 @@ private:
 
     std::string getFunctionName(const Token *ftok, bool &error) const;
 
+    std::string findFunctionName(const Token *ftok) const;
+
+    bool findIsNotLibraryFunction(const Token *ftok) const;
+
     static const AllocFunc* getAllocDealloc(const std::map<std::string, AllocFunc> &data, const std::string &name) {
         const std::map<std::string, AllocFunc>::const_iterator it = data.find(name);
         return (it == data.end()) ? nullptr : &it->second;
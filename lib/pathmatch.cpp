@@ -25,12 +25,15 @@
 #include <utility>
 
 PathMatch::PathMatch(std::vector<std::string> excludedPaths, bool caseSensitive)
-    : mExcludedPaths(std::move(excludedPaths)), mCaseSensitive(caseSensitive)
+    : mCaseSensitive(caseSensitive)
 {
-    if (!mCaseSensitive)
-        for (std::string& excludedPath : mExcludedPaths)
+    const std::vector<std::string> workingDirectory(1, Path::getCurrentPath());
+    for (std::string& excludedPath : excludedPaths) {
+        if (!mCaseSensitive)
             strTolower(excludedPath);
-    mWorkingDirectory.push_back(Path::getCurrentPath());
+        mRelativePathMasks.add(Path::isAbsolute(excludedPath) ? Path::getRelativePath(excludedPath, workingDirectory) : excludedPath);
+        mAbsolutePathMasks.add(std::move(excludedPath));
+    }
 }
 
 bool PathMatch::match(const std::string &path) const
@@ -38,41 +41,60 @@ bool PathMatch::match(const std::string &path) const
     if (path.empty())
         return false;
 
-    for (std::vector<std::string>::const_iterator i = mExcludedPaths.cbegin(); i != mExcludedPaths.cend(); ++i) {
-        const std::string excludedPath((!Path::isAbsolute(path) && Path::isAbsolute(*i)) ? Path::getRelativePath(*i, mWorkingDirectory) : *i);
+    std::string findpath = Path::fromNativeSeparators(path);
+    if (!mCaseSensitive)
+        strTolower(findpath);
 
-        std::string findpath = Path::fromNativeSeparators(path);
-        if (!mCaseSensitive)
-            strTolower(findpath);
+    return (Path::isAbsolute(path) ? mAbsolutePathMasks : mRelativePathMasks).match(findpath);
+}
 
-        // Filtering directory name
-        if (endsWith(excludedPath,'/')) {
-            if (!endsWith(findpath,'/'))
-                findpath = removeFilename(findpath);
+void PathMatch::Masks::add(std::string mask)
+{
+    if (endsWith(mask, '/')) {
+        dirLengths.insert(mask.size());
+        dirs.insert(std::move(mask));
+    } else {
+        fileLengths.insert(mask.size());
+        files.insert(std::move(mask));
+    }
+}
 
-            if (excludedPath.length() > findpath.length())
-                continue;
-            // Match relative paths starting with mask
-            // -isrc matches src/foo.cpp
-            if (findpath.compare(0, excludedPath.size(), excludedPath) == 0)
-                return true;
-            // Match only full directory name in middle or end of the path
-            // -isrc matches myproject/src/ but does not match
-            // myproject/srcfiles/ or myproject/mysrc/
-            if (findpath.find("/" + excludedPath) != std::string::npos)
-                return true;
-        }
-        // Filtering filename
-        else {
-            if (excludedPath.length() > findpath.length())
-                continue;
-            // Check if path ends with mask
-            // -ifoo.cpp matches (./)foo.c, src/foo.cpp and proj/src/foo.cpp
-            // -isrc/file.cpp matches src/foo.cpp and proj/src/foo.cpp
-            if (findpath.compare(findpath.size() - excludedPath.size(), findpath.size(), excludedPath) == 0)
-                return true;
+bool PathMatch::Masks::match(const std::string &findpath) const
+{
+    // Filtering filename
+    // Check if path ends with mask
+    // -ifoo.cpp matches (./)foo.c, src/foo.cpp and proj/src/foo.cpp
+    // -isrc/file.cpp matches src/foo.cpp and proj/src/foo.cpp
+    for (const std::size_t len : fileLengths) {
+        if (len > findpath.size())
+            break;
+        if (files.find(findpath.substr(findpath.size() - len)) != files.end())
+            return true;
+    }
 
+    if (dirs.empty())
+        return false;
+
+    // Filtering directory name
+    const std::string dirpath = endsWith(findpath, '/') ? findpath : removeFilename(findpath);
+
+    // Match relative paths starting with mask
+    // -isrc matches src/foo.cpp
+    // Match only full directory name in middle or end of the path
+    // -isrc matches myproject/src/ but does not match
+    // myproject/srcfiles/ or myproject/mysrc/
+    // So the mask must start at the beginning or after a '/', and it ends with a '/'
+    std::string::size_type start = 0;
+    for (;;) {
+        for (std::string::size_type end = dirpath.find('/', start); end != std::string::npos; end = dirpath.find('/', end + 1)) {
+            const std::size_t len = end + 1 - start;
+            if (dirLengths.count(len) > 0 && dirs.find(dirpath.substr(start, len)) != dirs.end())
+                return true;
         }
+        start = dirpath.find('/', start);
+        if (start == std::string::npos)
+            break;
+        ++start;
     }
     return false;
 }
@@ -21,7 +21,10 @@
 
 #include "config.h"
 
+#include <cstddef>
+#include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 /// @addtogroup CLI
@@ -58,9 +61,24 @@ protected:
     static std::string removeFilename(const std::string &path);
 
 private:
-    std::vector<std::string> mExcludedPaths;
+    /** Masks, split by kind so that a path is matched with hash lookups */
+    struct Masks {
+        void add(std::string mask);
+        bool match(const std::string &findpath) const;
+
+        /** directory masks (ending with '/') */
+        std::unordered_set<std::string> dirs;
+        std::set<std::size_t> dirLengths;
+        /** file masks */
+        std::unordered_set<std::string> files;
+        std::set<std::size_t> fileLengths;
+    };
+
     bool mCaseSensitive;
-    std::vector<std::string> mWorkingDirectory;
+    /** masks used for absolute paths */
+    Masks mAbsolutePathMasks;
+    /** masks used for relative paths, absolute masks are made relative to the working directory */
+    Masks mRelativePathMasks;
 };
 
 /// @}
@@ -50,7 +50,8 @@ std::size_t ExprIdToken::Hash::operator()(ExprIdToken etok) const
 }
 
 void ProgramMemory::setValue(const Token* expr, const ValueFlow::Value& value) {
-    mValues[expr] = value;
+    copyOnWrite();
+    (*mValues)[expr] = value;
     ValueFlow::Value subvalue = value;
     const Token* subexpr = solveExprValue(
         expr,
@@ -64,12 +65,14 @@ void ProgramMemory::setValue(const Token* expr, const ValueFlow::Value& value) {
     },
         subvalue);
     if (subexpr)
-        mValues[subexpr] = subvalue;
+        (*mValues)[subexpr] = subvalue;
 }
 const ValueFlow::Value* ProgramMemory::getValue(nonneg int exprid, bool impossible) const
 {
-    const ProgramMemory::Map::const_iterator it = mValues.find(exprid);
-    const bool found = it != mValues.cend() && (impossible || !it->second.isImpossible());
+    if (!mValues)
+        return nullptr;
+    const ProgramMemory::Map::const_iterator it = mValues->find(exprid);
+    const bool found = it != mValues->cend() && (impossible || !it->second.isImpossible());
     if (found)
         return &it->second;
     return nullptr;
@@ -140,26 +143,42 @@ void ProgramMemory::setContainerSizeValue(const Token* expr, MathLib::bigint val
 }
 
 void ProgramMemory::setUnknown(const Token* expr) {
-    mValues[expr].valueType = ValueFlow::Value::ValueType::UNINIT;
+    copyOnWrite();
+    (*mValues)[expr].valueType = ValueFlow::Value::ValueType::UNINIT;
 }
 
 bool ProgramMemory::hasValue(nonneg int exprid)
 {
-    return mValues.find(exprid) != mValues.end();
+    return mValues && mValues->find(exprid) != mValues->end();
 }
 
 const ValueFlow::Value& ProgramMemory::at(nonneg int exprid) const {
-    return mValues.at(exprid);
+    return getMap().at(exprid);
 }
 ValueFlow::Value& ProgramMemory::at(nonneg int exprid) {
-    return mValues.at(exprid);
+    copyOnWrite();
+    return mValues->at(exprid);
 }
 
 void ProgramMemory::erase_if(const std::function<bool(const ExprIdToken&)>& pred)
 {
-    for (auto it = mValues.begin(); it != mValues.end();) {
+    if (!mValues)
+        return;
+    // Only copy a shared map if something is erased
+    auto it = std::find_if(mValues->cbegin(), mValues->cend(), [&](const Map::value_type& p) {
+        return pred(p.first);
+    });
+    if (it == mValues->cend())
+        return;
+    if (mValues.use_count() > 1) {
+        const ExprIdToken first = it->first;
+        copyOnWrite();
+        it = mValues->find(first);
+    }
+    it = mValues->erase(it);
+    while (it != mValues->cend()) {
         if (pred(it->first))
-            it = mValues.erase(it);
+            it = mValues->erase(it);
         else
             ++it;
     }
@@ -172,25 +191,56 @@ void ProgramMemory::swap(ProgramMemory &pm)
 
 void ProgramMemory::clear()
 {
-    mValues.clear();
+    if (mValues.use_count() == 1)
+        mValues->clear();
+    else
+        mValues.reset();
 }
 
 bool ProgramMemory::empty() const
 {
-    return mValues.empty();
+    return !mValues || mValues->empty();
 }
 
 void ProgramMemory::replace(const ProgramMemory &pm)
 {
-    for (auto&& p : pm.mValues) {
-        mValues[p.first] = p.second;
+    if (pm.mValues == mValues || pm.empty())
+        return;
+    if (empty()) {
+        mValues = pm.mValues;
+        return;
+    }
+    copyOnWrite();
+    for (auto&& p : *pm.mValues) {
+        (*mValues)[p.first] = p.second;
     }
 }
 
 void ProgramMemory::insert(const ProgramMemory &pm)
 {
+    if (pm.mValues == mValues || pm.empty())
+        return;
+    if (empty()) {
+        mValues = pm.mValues;
+        return;
+    }
+    copyOnWrite();
     for (auto&& p : pm)
-        mValues.insert(p);
+        mValues->insert(p);
+}
+
+const ProgramMemory::Map& ProgramMemory::getMap() const
+{
+    static const Map emptyMap;
+    return mValues ? *mValues : emptyMap;
+}
+
+void ProgramMemory::copyOnWrite()
+{
+    if (!mValues)
+        mValues = std::make_shared<Map>();
+    else if (mValues.use_count() > 1)
+        mValues = std::make_shared<Map>(*mValues);
 }
 
 static ValueFlow::Value execute(const Token* expr, ProgramMemory& pm, const Settings* settings = nullptr);
@@ -1208,9 +1258,9 @@ struct Executor {
             return *value;
         }
         if (expr->isNumber()) {
-            if (MathLib::isFloat(expr->str()))
+            if (expr->isFloatNumber())
                 return unknown;
-            MathLib::bigint i = MathLib::toLongNumber(expr->str());
+            MathLib::bigint i = expr->toLongNumber();
             if (i < 0 && astIsUnsigned(expr))
                 return unknown;
             return ValueFlow::Value{i};
@@ -1588,3 +1638,178 @@ void execute(const Token* expr,
     } else if (result)
         *result = v.intvalue;
 }
+
+using CompiledEval = std::function<bool(CompiledExpression::Slots&, MathLib::bigint&)>;
+
+static CompiledEval compileConstant(MathLib::bigint value)
+{
+    return [value](CompiledExpression::Slots& /*slots*/, MathLib::bigint& result) {
+        result = value;
+        return true;
+    };
+}
+
+static std::size_t getSlot(std::vector<nonneg int>& exprIds, nonneg int exprid)
+{
+    const auto it = std::find(exprIds.cbegin(), exprIds.cend(), exprid);
+    if (it != exprIds.cend())
+        return it - exprIds.cbegin();
+    exprIds.push_back(exprid);
+    return exprIds.size() - 1;
+}
+
+static bool isCompiledBinaryOp(const std::string& op)
+{
+    return contains({"+", "-", "*", "/", "%", "&", "|", "^", "<<", ">>", "<", ">", "<=", ">=", "==", "!="}, op);
+}
+
+// Lowers the same subset of expressions that Executor::executeImpl() handles for integers
+static CompiledEval compileExpression(const Token* expr, std::vector<nonneg int>& exprIds)
+{
+    if (!expr)
+        return nullptr;
+    if (expr->hasKnownIntValue() && !expr->isAssignmentOp() && expr->str() != ",") {
+        const ValueFlow::Value& value = expr->values().front();
+        if (!value.isIntValue() || !value.isKnown())
+            return nullptr;
+        return compileConstant(value.intvalue);
+    }
+    if (std::any_of(expr->values().cbegin(), expr->values().cend(), [](const ValueFlow::Value& v) {
+        return v.isKnown() && !v.isIntValue();
+    }))
+        return nullptr;
+    if (expr->isNumber()) {
+        if (expr->isFloatNumber())
+            return nullptr;
+        const MathLib::bigint i = expr->toLongNumber();
+        if (i < 0 && astIsUnsigned(expr))
+            return nullptr;
+        return compileConstant(i);
+    }
+    if (expr->isBoolean())
+        return compileConstant(expr->str() == "true");
+    const Token* op1 = expr->astOperand1();
+    const Token* op2 = expr->astOperand2();
+    if (expr->isAssignmentOp()) {
+        if (!op1 || !op2 || op1->varId() == 0 || op1->exprId() == 0)
+            return nullptr;
+        CompiledEval rhs = compileExpression(op2, exprIds);
+        if (!rhs)
+            return nullptr;
+        const std::size_t slot = getSlot(exprIds, op1->exprId());
+        if (expr->str() == "=") {
+            return [slot, rhs](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+                if (!rhs(slots, result))
+                    return false;
+                slots[slot] = result;
+                return true;
+            };
+        }
+        const std::string op = removeAssign(expr->str());
+        if (!isCompiledBinaryOp(op))
+            return nullptr;
+        return [slot, rhs, op](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            MathLib::bigint y = 0;
+            if (!rhs(slots, y))
+                return false;
+            bool error = false;
+            result = calculate(op, slots[slot], y, &error);
+            if (error)
+                return false;
+            slots[slot] = result;
+            return true;
+        };
+    }
+    if (Token::Match(expr, "&&|%oror%|,") && op1 && op2) {
+        CompiledEval lhs = compileExpression(op1, exprIds);
+        CompiledEval rhs = compileExpression(op2, exprIds);
+        if (!lhs || !rhs)
+            return nullptr;
+        const char kind = expr->str()[0];
+        return [kind, lhs, rhs](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            if (!lhs(slots, result))
+                return false;
+            if ((kind == '&' && result == 0) || (kind == '|' && result != 0))
+                return true;
+            return rhs(slots, result);
+        };
+    }
+    if (expr->tokType() == Token::eIncDecOp && op1 && op1->varId() > 0 && op1->exprId() > 0) {
+        const std::size_t slot = getSlot(exprIds, op1->exprId());
+        const bool increment = expr->str() == "++";
+        const bool isUnsigned = astIsUnsigned(op1);
+        return [slot, increment, isUnsigned](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            // overflow
+            if (!increment && isUnsigned && slots[slot] == 0)
+                return false;
+            if (increment)
+                slots[slot]++;
+            else
+                slots[slot]--;
+            result = slots[slot];
+            return true;
+        };
+    }
+    if (Token::Match(expr, "%cop%") && op1 && op2) {
+        if (!isCompiledBinaryOp(expr->str()))
+            return nullptr;
+        CompiledEval lhs = compileExpression(op1, exprIds);
+        CompiledEval rhs = compileExpression(op2, exprIds);
+        if (!lhs || !rhs)
+            return nullptr;
+        const std::string op = expr->str();
+        return [op, lhs, rhs](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            MathLib::bigint x = 0;
+            MathLib::bigint y = 0;
+            if (!lhs(slots, x) || !rhs(slots, y))
+                return false;
+            bool error = false;
+            result = calculate(op, x, y, &error);
+            return !error;
+        };
+    }
+    if (Token::Match(expr, "!|+|-") && op1 && !op2) {
+        CompiledEval lhs = compileExpression(op1, exprIds);
+        if (!lhs)
+            return nullptr;
+        const char kind = expr->str()[0];
+        return [kind, lhs](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            if (!lhs(slots, result))
+                return false;
+            if (kind == '!')
+                result = result == 0;
+            else if (kind == '-')
+                result = -result;
+            return true;
+        };
+    }
+    if (expr->str() == "?" && op1 && Token::simpleMatch(op2, ":")) {
+        CompiledEval cond = compileExpression(op1, exprIds);
+        CompiledEval lhs = compileExpression(op2->astOperand1(), exprIds);
+        CompiledEval rhs = compileExpression(op2->astOperand2(), exprIds);
+        if (!cond || !lhs || !rhs)
+            return nullptr;
+        return [cond, lhs, rhs](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            if (!cond(slots, result))
+                return false;
+            return result != 0 ? lhs(slots, result) : rhs(slots, result);
+        };
+    }
+    if (expr->str() == "(" && expr->isCast()) {
+        if (Token::simpleMatch(expr->previous(), ">") && expr->previous()->link())
+            return compileExpression(op2, exprIds);
+        return compileExpression(op1, exprIds);
+    }
+    if (expr->varId() > 0 && expr->exprId() > 0 && !op1 && !op2) {
+        const std::size_t slot = getSlot(exprIds, expr->exprId());
+        return [slot](CompiledExpression::Slots& slots, MathLib::bigint& result) {
+            result = slots[slot];
+            return true;
+        };
+    }
+    return nullptr;
+}
+
+CompiledExpression::CompiledExpression(const Token* expr, std::vector<nonneg int>& exprIds)
+    : mEval(compileExpression(expr, exprIds))
+{}
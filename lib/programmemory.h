@@ -26,6 +26,7 @@
 #include <cstddef>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -71,7 +72,7 @@ struct ProgramMemory {
 
     ProgramMemory() = default;
 
-    explicit ProgramMemory(Map values) : mValues(std::move(values)) {}
+    explicit ProgramMemory(Map values) : mValues(std::make_shared<Map>(std::move(values))) {}
 
     void setValue(const Token* expr, const ValueFlow::Value& value);
     const ValueFlow::Value* getValue(nonneg int exprid, bool impossible = false) const;
@@ -104,23 +105,31 @@ struct ProgramMemory {
     void insert(const ProgramMemory &pm);
 
     Map::iterator begin() {
-        return mValues.begin();
+        copyOnWrite();
+        return mValues->begin();
     }
 
     Map::iterator end() {
-        return mValues.end();
+        copyOnWrite();
+        return mValues->end();
     }
 
     Map::const_iterator begin() const {
-        return mValues.begin();
+        return getMap().begin();
     }
 
     Map::const_iterator end() const {
-        return mValues.end();
+        return getMap().end();
     }
 
 private:
-    Map mValues;
+    const Map& getMap() const;
+
+    void copyOnWrite();
+
+    // Copies of a ProgramMemory share the map until one of them is modified.
+    // An empty ProgramMemory has no map, it is allocated by the first write.
+    std::shared_ptr<Map> mValues;
 };
 
 void programMemoryParseCondition(ProgramMemory& pm, const Token* tok, const Token* endTok, const Settings* settings, bool then);
@@ -152,6 +161,32 @@ void execute(const Token* expr,
              bool* error,
              const Settings* settings = nullptr);
 
+/**
+ * Integer expression that is lowered from the AST once so it can be evaluated many times
+ * without interpreting the tokens again. Only literals, integer variables and arithmetic,
+ * comparison, logical and assignment operators are supported. The result is the same as
+ * execute() when all variables have known integer values.
+ */
+class CompiledExpression {
+public:
+    using Slots = std::vector<MathLib::bigint>;
+
+    /// Lower expr, the expression id of each variable is added to exprIds and its index is the slot
+    CompiledExpression(const Token* expr, std::vector<nonneg int>& exprIds);
+
+    bool valid() const {
+        return static_cast<bool>(mEval);
+    }
+
+    /// Evaluate using the variable values in slots. Returns false if the result is unknown.
+    bool execute(Slots& slots, MathLib::bigint& result) const {
+        return mEval(slots, result);
+    }
+
+private:
+    std::function<bool(Slots&, MathLib::bigint&)> mEval;
+};
+
 /**
  * Is condition always false when variable has given value?
  * \param condition   top ast token in condition
@@ -189,6 +189,7 @@ void Settings::setCheckLevelExhaustive()
     // Checking can take a little while. ~ 10 times slower than normal analysis is OK.
     performanceValueFlowMaxIfCount = -1;
     performanceValueFlowMaxSubFunctionArgs = 256;
+    performanceValueFlowForwardBudget = -1;
 }
 
 void Settings::setCheckLevelNormal()
@@ -196,4 +197,5 @@ void Settings::setCheckLevelNormal()
     // Checking should finish in reasonable time.
     performanceValueFlowMaxSubFunctionArgs = 8;
     performanceValueFlowMaxIfCount = 100;
+    performanceValueFlowForwardBudget = 20000;
 }
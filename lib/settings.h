@@ -249,6 +249,9 @@ public:
     /** @brief max number of sets of arguments to pass to subfuncions in valueflow */
     int performanceValueFlowMaxSubFunctionArgs;
 
+    /** @brief max number of tokens all forward analysis in valueflow may visit in one function, in percent of the function size (-1 = no limit) */
+    int performanceValueFlowForwardBudget;
+
     /** @brief plist output (--plist-output=&lt;dir&gt;) */
     std::string plistOutput;
 
@@ -31,6 +31,7 @@
 #include <cstring>
 #include <functional> // std::bind, std::placeholders
 #include <sstream> // IWYU pragma: keep
+#include <unordered_map>
 #include <utility>
 
 #include <tinyxml2.h>
@@ -47,6 +48,24 @@ static bool isAcceptedErrorIdChar(char c)
     }
 }
 
+// cppcheck-suppress missingMemberCopy - the index points into the list so it is rebuilt
+Suppressions::Suppressions(const Suppressions &other)
+    : mSuppressions(other.mSuppressions)
+{
+    std::size_t position = 0;
+    for (Suppression &suppression : mSuppressions)
+        addToIndex(position++, &suppression);
+}
+
+Suppressions &Suppressions::operator=(const Suppressions &other)
+{
+    if (this != &other) {
+        Suppressions copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
 std::string Suppressions::parseFile(std::istream &istr)
 {
     // Change '\r' to '\n' in the istr
@@ -253,10 +272,19 @@ std::string Suppressions::addSuppression(Suppressions::Suppression suppression)
         return "Failed to add suppression. Invalid glob pattern '" + suppression.fileName + "'.";
 
     mSuppressions.push_back(std::move(suppression));
+    addToIndex(mSuppressions.size() - 1, &mSuppressions.back());
 
     return "";
 }
 
+void Suppressions::addToIndex(std::size_t position, Suppression *suppression)
+{
+    if (suppression->errorId.empty() || suppression->errorId.find_first_of("*?") != std::string::npos)
+        mGlobSuppressions.emplace_back(position, suppression);
+    else
+        mSuppressionsById[suppression->errorId].emplace_back(position, suppression);
+}
+
 std::string Suppressions::addSuppressions(std::list<Suppression> suppressions)
 {
     for (auto &newSuppression : suppressions) {
@@ -368,13 +396,25 @@ std::string Suppressions::Suppression::getText() const
 
 bool Suppressions::isSuppressed(const Suppressions::ErrorMessage &errmsg, bool global)
 {
+    static const std::vector<IndexedSuppression> none;
+
     const bool unmatchedSuppression(errmsg.errorId == "unmatchedSuppression");
-    for (Suppression &s : mSuppressions) {
-        if (!global && !s.isLocal())
+    const std::unordered_map<std::string, std::vector<IndexedSuppression>>::const_iterator it = mSuppressionsById.find(errmsg.errorId);
+    const std::vector<IndexedSuppression> &byId = (it != mSuppressionsById.cend()) ? it->second : none;
+    const std::vector<IndexedSuppression> &globs = unmatchedSuppression ? none : mGlobSuppressions;
+
+    // Try the candidates in list order, the first match is marked as matched
+    std::vector<IndexedSuppression>::const_iterator it1 = byId.cbegin();
+    std::vector<IndexedSuppression>::const_iterator it2 = globs.cbegin();
+    while (it1 != byId.cend() || it2 != globs.cend()) {
+        Suppression *s;
+        if (it2 == globs.cend() || (it1 != byId.cend() && it1->first < it2->first))
+            s = (it1++)->second;
+        else
+            s = (it2++)->second;
+        if (!global && !s->isLocal())
             continue;
-        if (unmatchedSuppression && s.errorId != errmsg.errorId)
-            continue;
-        if (s.isMatch(errmsg))
+        if (s->isMatch(errmsg))
             return true;
     }
     return false;
@@ -447,15 +487,27 @@ const std::list<Suppressions::Suppression> &Suppressions::getSuppressions() cons
 }
 
 void Suppressions::markUnmatchedInlineSuppressionsAsChecked(const Tokenizer &tokenizer) {
+    // unchecked suppressions by line number
+    std::unordered_map<int, std::vector<Suppression *>> unchecked;
+    for (Suppression &suppression : mSuppressions) {
+        if (!suppression.checked)
+            unchecked[suppression.lineNumber].push_back(&suppression);
+    }
+    if (unchecked.empty())
+        return;
+
     int currLineNr = -1;
     int currFileIdx = -1;
     for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
         if (currFileIdx != tok->fileIndex() || currLineNr != tok->linenr()) {
             currLineNr = tok->linenr();
             currFileIdx = tok->fileIndex();
-            for (auto &suppression : mSuppressions) {
-                if (!suppression.checked && (suppression.lineNumber == currLineNr) && (suppression.fileName == tokenizer.list.file(tok))) {
-                    suppression.checked = true;
+            const std::unordered_map<int, std::vector<Suppression *>>::const_iterator it = unchecked.find(currLineNr);
+            if (it == unchecked.cend())
+                continue;
+            for (Suppression *suppression : it->second) {
+                if (!suppression->checked && (suppression->fileName == tokenizer.list.file(tok))) {
+                    suppression->checked = true;
                 }
             }
         }
@@ -26,6 +26,7 @@
 #include <istream>
 #include <list>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -39,6 +40,11 @@ enum class Certainty;
 /** @brief class for handling suppressions */
 class CPPCHECKLIB Suppressions {
 public:
+    Suppressions() = default;
+    Suppressions(const Suppressions &other);
+    Suppressions(Suppressions &&other) = default;
+    Suppressions &operator=(const Suppressions &other);
+    Suppressions &operator=(Suppressions &&other) = default;
 
     struct CPPCHECKLIB ErrorMessage {
         std::size_t hash;
@@ -202,8 +208,20 @@ public:
     void markUnmatchedInlineSuppressionsAsChecked(const Tokenizer &tokenizer);
 
 private:
+    /** Suppression and its position in mSuppressions */
+    using IndexedSuppression = std::pair<std::size_t, Suppression *>;
+
+    /** @brief Add a suppression in mSuppressions to the index */
+    void addToIndex(std::size_t position, Suppression *suppression);
+
     /** @brief List of error which the user doesn't want to see. */
     std::list<Suppression> mSuppressions;
+
+    /** @brief Suppressions with a plain errorId, by errorId. Each vector is in list order. */
+    std::unordered_map<std::string, std::vector<IndexedSuppression>> mSuppressionsById;
+
+    /** @brief Suppressions with an errorId glob pattern or without errorId, in list order */
+    std::vector<IndexedSuppression> mGlobSuppressions;
 };
 
 /// @}
@@ -1637,20 +1637,27 @@ void SymbolDatabase::createSymbolDatabaseExprIds()
         }
 
         // Apply CSE
+        std::unordered_map<const Token*, std::size_t> exprHashes;
         for (const auto& p:exprs) {
-            const std::vector<Token*>& tokens = p.second;
-            const std::size_t N = tokens.size();
-            for (std::size_t i = 0; i < N; ++i) {
-                Token* const tok1 = tokens[i];
-                for (std::size_t j = i + 1; j < N; ++j) {
-                    Token* const tok2 = tokens[j];
-                    if (tok1->exprId() == tok2->exprId())
-                        continue;
-                    if (!isSameExpression(isCPP(), true, tok1, tok2, mSettings.library, false, false))
-                        continue;
-                    nonneg int const cid = std::min(tok1->exprId(), tok2->exprId());
-                    tok1->exprId(cid);
-                    tok2->exprId(cid);
+            // Only expressions with the same hash can be the same
+            std::unordered_map<std::size_t, std::vector<Token*>> sameHash;
+            for (Token* tok : p.second)
+                sameHash[getExpressionHash(isCPP(), tok, exprHashes)].push_back(tok);
+            for (const auto& h:sameHash) {
+                const std::vector<Token*>& tokens = h.second;
+                const std::size_t N = tokens.size();
+                for (std::size_t i = 0; i < N; ++i) {
+                    Token* const tok1 = tokens[i];
+                    for (std::size_t j = i + 1; j < N; ++j) {
+                        Token* const tok2 = tokens[j];
+                        if (tok1->exprId() == tok2->exprId())
+                            continue;
+                        if (!isSameExpression(isCPP(), true, tok1, tok2, mSettings.library, false, false))
+                            continue;
+                        nonneg int const cid = std::min(tok1->exprId(), tok2->exprId());
+                        tok1->exprId(cid);
+                        tok2->exprId(cid);
+                    }
                 }
             }
         }
@@ -1729,7 +1736,7 @@ void SymbolDatabase::setArrayDimensionsUsingValueFlow()
 
                 if (Token::Match(tokenList.front(), "; %num% ;")) {
                     dimension.known = true;
-                    dimension.num = MathLib::toLongNumber(tokenList.front()->next()->str());
+                    dimension.num = tokenList.front()->next()->toLongNumber();
                 }
 
                 continue;
@@ -3571,7 +3578,7 @@ bool Variable::arrayDimensions(const Settings* settings, bool& isContainer)
             if (Token::Match(tok, "%num% [,>]")) {
                 dimension_.tok = tok;
                 dimension_.known = true;
-                dimension_.num = MathLib::toLongNumber(tok->str());
+                dimension_.num = tok->toLongNumber();
             } else if (tok) {
                 dimension_.tok = tok;
                 dimension_.known = false;
@@ -6888,7 +6895,7 @@ void SymbolDatabase::setValueTypeInTokenList(bool reportDebugWarnings, Token *to
 
     for (Token *tok = tokens; tok; tok = tok->next()) {
         if (tok->isNumber()) {
-            if (MathLib::isFloat(tok->str())) {
+            if (tok->isFloatNumber()) {
                 ValueType::Type type = ValueType::Type::DOUBLE;
                 const char suffix = tok->str()[tok->str().size() - 1];
                 if (suffix == 'f' || suffix == 'F')
@@ -6896,7 +6903,7 @@ void SymbolDatabase::setValueTypeInTokenList(bool reportDebugWarnings, Token *to
                 else if (suffix == 'L' || suffix == 'l')
                     type = ValueType::Type::LONGDOUBLE;
                 setValueType(tok, ValueType(ValueType::Sign::UNKNOWN_SIGN, type, 0U));
-            } else if (MathLib::isInt(tok->str())) {
+            } else if (tok->isIntNumber()) {
                 const std::string tokStr = MathLib::abs(tok->str());
                 const bool unsignedSuffix = (tokStr.find_last_of("uU") != std::string::npos);
                 ValueType::Sign sign = unsignedSuffix ? ValueType::Sign::UNSIGNED : ValueType::Sign::SIGNED;
@@ -1045,6 +1045,9 @@ public:
     // function specific fields
     const Scope* functionOf{}; ///< scope this function belongs to
     Function* function{}; ///< function info for this function
+    mutable std::size_t forwardBudget{}; ///< tokens that ValueFlow forward analysis may still visit in this function
+    mutable bool hasForwardBudget{}; ///< is forward analysis limited by forwardBudget
+    mutable bool forwardBudgetExceeded{}; ///< has forward analysis run out of forwardBudget
 
     // enum specific fields
     const Token* enumType{};
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <stack>
@@ -715,12 +716,45 @@ void TemplateSimplifier::addInstantiation(Token *token, const std::string &scope
     TokenAndName instantiation(token, scope);
 
     // check if instantiation already exists before adding it
-    const std::list<TokenAndName>::const_iterator it = std::find(mTemplateInstantiations.cbegin(),
-                                                                 mTemplateInstantiations.cend(),
-                                                                 instantiation);
+    const std::set<TokenAndName*> *pointers = token->templateSimplifierPointers();
+    const bool exists = pointers && std::any_of(pointers->cbegin(), pointers->cend(), [&](const TokenAndName *p) {
+        return p != &instantiation &&
+        mTemplateInstantiationsIndex.find(p) != mTemplateInstantiationsIndex.end() &&
+        *p == instantiation;
+    });
+
+    if (!exists)
+        addInstantiationEntry(std::move(instantiation));
+}
+
+void TemplateSimplifier::addInstantiationEntry(TokenAndName &&instantiation)
+{
+    mTemplateInstantiations.emplace_back(std::move(instantiation));
+    mTemplateInstantiationsIndex[&mTemplateInstantiations.back()] = std::prev(mTemplateInstantiations.end());
+}
+
+std::list<TemplateSimplifier::TokenAndName>::iterator TemplateSimplifier::eraseInstantiation(std::list<TokenAndName>::iterator it)
+{
+    mTemplateInstantiationsIndex.erase(&*it);
+    return mTemplateInstantiations.erase(it);
+}
 
-    if (it == mTemplateInstantiations.cend())
-        mTemplateInstantiations.emplace_back(std::move(instantiation));
+std::list<TemplateSimplifier::TokenAndName>::iterator TemplateSimplifier::findInstantiation(const Token *tok)
+{
+    std::list<TokenAndName>::iterator ret = mTemplateInstantiations.end();
+    const std::set<TokenAndName*> *pointers = tok->templateSimplifierPointers();
+    if (!pointers)
+        return ret;
+    for (const TokenAndName *p : *pointers) {
+        const auto it = mTemplateInstantiationsIndex.find(p);
+        if (it == mTemplateInstantiationsIndex.end())
+            continue;
+        // several instantiations => the first one in the list is wanted
+        if (ret != mTemplateInstantiations.end())
+            return std::find_if(mTemplateInstantiations.begin(), mTemplateInstantiations.end(), FindToken(tok));
+        ret = it->second;
+    }
+    return ret;
 }
 
 static const Token* getFunctionToken(const Token* nameToken)
@@ -1233,11 +1267,9 @@ void TemplateSimplifier::useDefaultArgumentValues(TokenAndName &declaration)
             if (Token::Match(tok2, "(|{|["))
                 tok2 = tok2->link();
             else if (Token::Match(tok2, "%type% <") && (tok2->strAt(2) == ">" || templateParameters(tok2->next()))) {
-                const std::list<TokenAndName>::iterator ti = std::find_if(mTemplateInstantiations.begin(),
-                                                                          mTemplateInstantiations.end(),
-                                                                          FindToken(tok2));
+                const std::list<TokenAndName>::iterator ti = findInstantiation(tok2);
                 if (ti != mTemplateInstantiations.end())
-                    mTemplateInstantiations.erase(ti);
+                    eraseInstantiation(ti);
                 ++indentlevel;
             } else if (indentlevel > 0 && tok2->str() == ">")
                 --indentlevel;
@@ -1358,9 +1390,7 @@ void TemplateSimplifier::simplifyTemplateAliases()
                 if (aliasParameterNames.find(tok2->str()) == aliasParameterNames.end()) {
                     // Create template instance..
                     if (Token::Match(tok1, "%name% <")) {
-                        const std::list<TokenAndName>::const_iterator it = std::find_if(mTemplateInstantiations.cbegin(),
-                                                                                        mTemplateInstantiations.cend(),
-                                                                                        FindToken(tok1));
+                        const std::list<TokenAndName>::const_iterator it = findInstantiation(tok1);
                         if (it != mTemplateInstantiations.cend())
                             addInstantiation(tok2, it->scope());
                     }
@@ -1372,7 +1402,7 @@ void TemplateSimplifier::simplifyTemplateAliases()
             found = true;
 
             // erase this instantiation
-            it2 = mTemplateInstantiations.erase(it2);
+            it2 = eraseInstantiation(it2);
         }
 
         if (found) {
@@ -1877,7 +1907,10 @@ void TemplateSimplifier::expandTemplate(
         }
     }
 
-    for (Token *tok3 = mTokenList.front(); tok3; tok3 = tok3 ? tok3->next() : nullptr) {
+    // Member functions implemented outside the class can be anywhere, so the whole token
+    // list is searched. Without them only the definition itself needs to be copied.
+    const bool onlyDefinition = copy && (isClass || isFunction) && mOutOfLineMemberNames.count(templateInstantiation.name()) == 0;
+    for (Token *tok3 = onlyDefinition ? templateDeclaration.token() : mTokenList.front(); tok3; tok3 = tok3 ? tok3->next() : nullptr) {
         if (inTemplateDefinition) {
             if (!endOfTemplateDefinition) {
                 if (isVariable) {
@@ -2276,6 +2309,8 @@ void TemplateSimplifier::expandTemplate(
         }
 
         assert(brackets.empty());
+        if (onlyDefinition)
+            break;
     }
 
     // add new instantiations
@@ -2286,7 +2321,7 @@ void TemplateSimplifier::expandTemplate(
         // only add recursive instantiation if its arguments are a constant expression
         if (templateDeclaration.name() != inst.token->str() ||
             (inst.token->tokAt(2)->isNumber() || inst.token->tokAt(2)->isStandardType()))
-            mTemplateInstantiations.emplace_back(inst.token, inst.scope);
+            addInstantiationEntry(TokenAndName(inst.token, inst.scope));
     }
 }
 
@@ -3386,14 +3421,9 @@ void TemplateSimplifier::replaceTemplateUsage(
         // Foo < int >  =>  Foo<int>
         for (const Token *tok = nameTok1->next(); tok != tok2; tok = tok->next()) {
             if (tok->isName() && tok->templateSimplifierPointers() && !tok->templateSimplifierPointers()->empty()) {
-                std::list<TokenAndName>::iterator ti;
-                for (ti = mTemplateInstantiations.begin(); ti != mTemplateInstantiations.end();) {
-                    if (ti->token() == tok) {
-                        ti = mTemplateInstantiations.erase(ti);
-                        break;
-                    }
-                    ++ti;
-                }
+                const std::list<TokenAndName>::iterator ti = findInstantiation(tok);
+                if (ti != mTemplateInstantiations.end())
+                    eraseInstantiation(ti);
             }
         }
         // Fix crash in #9007
@@ -3789,6 +3819,7 @@ void TemplateSimplifier::simplifyTemplates(
             mTemplateSpecializationMap.clear();
             mTemplatePartialSpecializationMap.clear();
             mTemplateInstantiations.clear();
+            mTemplateInstantiationsIndex.clear();
             mInstantiatedTemplates.clear();
             mExplicitInstantiationsToDelete.clear();
             mTemplateNamePos.clear();
@@ -3889,23 +3920,28 @@ void TemplateSimplifier::simplifyTemplates(
 
         std::set<std::string> expandedtemplates;
 
-        for (std::list<TokenAndName>::const_reverse_iterator iter1 = mTemplateDeclarations.crbegin(); iter1 != mTemplateDeclarations.crend(); ++iter1) {
-            if (iter1->isAlias() || iter1->isFriend())
+        // get specializations..
+        std::unordered_map<std::string, std::list<const Token *>> specializations;
+        for (const TokenAndName &decl : mTemplateDeclarations) {
+            if (decl.isAlias() || decl.isFriend())
                 continue;
+            specializations[decl.fullName()].push_back(decl.nameToken());
+        }
 
-            // get specializations..
-            std::list<const Token *> specializations;
-            for (std::list<TokenAndName>::const_iterator iter2 = mTemplateDeclarations.cbegin(); iter2 != mTemplateDeclarations.cend(); ++iter2) {
-                if (iter2->isAlias() || iter2->isFriend())
-                    continue;
+        // names of templates that may have members implemented outside the class
+        mOutOfLineMemberNames.clear();
+        for (const Token *tok = mTokenList.front(); tok; tok = tok->next()) {
+            if (Token::Match(tok, "%name% <") && Token::simpleMatch(tok->next()->findClosingBracket(), "> ::"))
+                mOutOfLineMemberNames.insert(tok->str());
+        }
 
-                if (iter1->fullName() == iter2->fullName())
-                    specializations.push_back(iter2->nameToken());
-            }
+        for (std::list<TokenAndName>::const_reverse_iterator iter1 = mTemplateDeclarations.crbegin(); iter1 != mTemplateDeclarations.crend(); ++iter1) {
+            if (iter1->isAlias() || iter1->isFriend())
+                continue;
 
             const bool instantiated = simplifyTemplateInstantiations(
                 *iter1,
-                specializations,
+                specializations[iter1->fullName()],
                 maxtime,
                 expandedtemplates);
             if (instantiated) {
@@ -348,6 +348,21 @@ private:
      */
     void addInstantiation(Token *token, const std::string &scope);
 
+    /** Append to mTemplateInstantiations and keep the index updated */
+    void addInstantiationEntry(TokenAndName &&instantiation);
+
+    /** Remove from mTemplateInstantiations and keep the index updated */
+    std::list<TokenAndName>::iterator eraseInstantiation(std::list<TokenAndName>::iterator it);
+
+    /**
+     * Find first instantiation in mTemplateInstantiations for given token.
+     * The token knows which TokenAndName objects point at it so the list is only
+     * searched when there are several instantiations for the token.
+     * @param tok instantiation name token
+     * @return iterator to the instantiation or mTemplateInstantiations.end()
+     */
+    std::list<TokenAndName>::iterator findInstantiation(const Token *tok);
+
     /**
      * Get template instantiations
      */
@@ -507,11 +522,13 @@ private:
     std::map<Token *, Token *> mTemplateSpecializationMap;
     std::map<Token *, Token *> mTemplatePartialSpecializationMap;
     std::list<TokenAndName> mTemplateInstantiations;
+    std::unordered_map<const TokenAndName*, std::list<TokenAndName>::iterator> mTemplateInstantiationsIndex;
     std::list<TokenAndName> mInstantiatedTemplates;
     std::list<TokenAndName> mMemberFunctionsToDelete;
     std::vector<TokenAndName> mExplicitInstantiationsToDelete;
     std::vector<TokenAndName> mTypesUsedInTemplateInstantiation;
     std::unordered_map<const Token*, int> mTemplateNamePos;
+    std::set<std::string> mOutOfLineMemberNames;
     std::string mDump;
 };
 
@@ -57,7 +57,7 @@ void TimerResults::showResults(SHOWTIME_MODES mode) const
     size_t ordinal = 1; // maybe it would be nice to have an ordinal in output later!
     for (std::vector<dataElementType>::const_iterator iter=data.cbegin(); iter!=data.cend(); ++iter) {
         const double sec = iter->second.seconds();
-        const double secAverage = sec / (double)(iter->second.mNumberOfResults);
+        const double secAverage = iter->second.mNumberOfResults > 0 ? sec / (double)(iter->second.mNumberOfResults) : 0.0;
         bool hasParent = false;
         {
             // Do not use valueFlow.. in "Overall time" because those are included in Tokenizer already
@@ -74,7 +74,10 @@ void TimerResults::showResults(SHOWTIME_MODES mode) const
         if (!hasParent)
             overallData.mClocks += iter->second.mClocks;
         if ((mode != SHOWTIME_MODES::SHOWTIME_TOP5) || (ordinal<=5)) {
-            std::cout << iter->first << ": " << sec << "s (avg. " << secAverage << "s - " << iter->second.mNumberOfResults  << " result(s))" << std::endl;
+            std::cout << iter->first << ": " << sec << "s (avg. " << secAverage << "s - " << iter->second.mNumberOfResults  << " result(s)";
+            if (iter->second.mNumberOfSkipped > 0)
+                std::cout << ", " << iter->second.mNumberOfSkipped << " skipped";
+            std::cout << ")" << std::endl;
         }
         ++ordinal;
     }
@@ -91,6 +94,13 @@ void TimerResults::addResults(const std::string& str, std::clock_t clocks)
     mResults[str].mNumberOfResults++;
 }
 
+void TimerResults::addSkipped(const std::string& str)
+{
+    std::lock_guard<std::mutex> l(mResultsSync);
+
+    mResults[str].mNumberOfSkipped++;
+}
+
 Timer::Timer(std::string str, SHOWTIME_MODES showtimeMode, TimerResultsIntf* timerResults)
     : mStr(std::move(str))
     , mTimerResults(timerResults)
@@ -45,6 +45,7 @@ public:
 struct TimerResultsData {
     std::clock_t mClocks{};
     long mNumberOfResults{};
+    long mNumberOfSkipped{};
 
     double seconds() const {
         const double ret = (double)((unsigned long)mClocks) / (double)CLOCKS_PER_SEC;
@@ -59,6 +60,9 @@ public:
     void showResults(SHOWTIME_MODES mode) const;
     void addResults(const std::string& str, std::clock_t clocks) override;
 
+    /** Count that the work measured as str was skipped */
+    void addSkipped(const std::string& str);
+
 private:
     std::map<std::string, struct TimerResultsData> mResults;
     mutable std::mutex mResultsSync;
@@ -187,6 +187,53 @@ void Token::update_property_info()
     update_property_isStandardType();
 }
 
+TokenImpl::NumberLiteral& Token::numberLiteral() const
+{
+    if (!mImpl->mNumberLiteral) {
+        mImpl->mNumberLiteral = new TokenImpl::NumberLiteral;
+        mImpl->mNumberLiteral->isInt = MathLib::isInt(mStr);
+        mImpl->mNumberLiteral->isFloat = MathLib::isFloat(mStr);
+    }
+    return *mImpl->mNumberLiteral;
+}
+
+TokenImpl::LibraryFunction* Token::libraryFunction(const Library *library) const
+{
+    if (!mTokensFrontBack || !mTokensFrontBack->list || !mTokensFrontBack->list->isFinal())
+        return nullptr;
+    if (!mImpl->mLibraryFunction)
+        mImpl->mLibraryFunction = new TokenImpl::LibraryFunction;
+    if (mImpl->mLibraryFunction->library != library) {
+        *mImpl->mLibraryFunction = TokenImpl::LibraryFunction();
+        mImpl->mLibraryFunction->library = library;
+    }
+    return mImpl->mLibraryFunction;
+}
+
+MathLib::bigint Token::toLongNumber() const
+{
+    if (mTokType != eNumber && mTokType != eChar)
+        return MathLib::toLongNumber(mStr);
+    TokenImpl::NumberLiteral& number = numberLiteral();
+    if (!number.hasIntValue) {
+        number.intValue = MathLib::toLongNumber(mStr);
+        number.hasIntValue = true;
+    }
+    return number.intValue;
+}
+
+double Token::toDoubleNumber() const
+{
+    if (mTokType != eNumber && mTokType != eChar)
+        return MathLib::toDoubleNumber(mStr);
+    TokenImpl::NumberLiteral& number = numberLiteral();
+    if (!number.hasDoubleValue) {
+        number.doubleValue = MathLib::toDoubleNumber(mStr);
+        number.hasDoubleValue = true;
+    }
+    return number.doubleValue;
+}
+
 static const std::unordered_set<std::string> stdTypes = { "bool"
                                                           , "_Bool"
                                                           , "char"
@@ -239,6 +286,8 @@ void Token::concatStr(std::string const& b)
     if (isCChar() && isStringLiteral(b) && b[0] != '"') {
         mStr.insert(0, b.substr(0, b.find('"')));
     }
+    delete mImpl->mNumberLiteral;
+    mImpl->mNumberLiteral = nullptr;
     update_property_info();
 }
 
@@ -2027,6 +2076,21 @@ static void mergeAdjacent(std::list<ValueFlow::Value>& values)
     }
 }
 
+// Is the impossible value y implied by the impossible bound x?
+static bool isCoveredBy(const ValueFlow::Value& y, const ValueFlow::Value& x)
+{
+    if (!x.isImpossible() || !y.isImpossible())
+        return false;
+    // Only values with a numeric order, compareValue() is always false for the others
+    if (!x.isIntValue() && !x.isFloatValue() && !x.isContainerSizeValue() && !x.isIteratorValue() && !x.isBufferSizeValue())
+        return false;
+    if (x.bound == ValueFlow::Value::Bound::Upper && y.bound != ValueFlow::Value::Bound::Lower)
+        return !x.compareValue(y, less{});
+    if (x.bound == ValueFlow::Value::Bound::Lower && y.bound != ValueFlow::Value::Bound::Upper)
+        return !y.compareValue(x, less{});
+    return false;
+}
+
 static void removeOverlaps(std::list<ValueFlow::Value>& values)
 {
     for (ValueFlow::Value& x : values) {
@@ -2041,7 +2105,9 @@ static void removeOverlaps(std::list<ValueFlow::Value>& values)
                 return false;
             if (x.valueKind != y.valueKind)
                 return false;
-            // TODO: Remove points covered in a lower or upper bound
+            // Remove points and bounds covered by an impossible lower or upper bound
+            if (isCoveredBy(y, x))
+                return true;
             // TODO: Remove lower or upper bound already covered by a lower and upper bound
             if (!x.equalValue(y))
                 return false;
@@ -2476,6 +2542,8 @@ TokenImpl::~TokenImpl()
     delete mOriginalName;
     delete mValueType;
     delete mValues;
+    delete mNumberLiteral;
+    delete mLibraryFunction;
 
     if (mTemplateSimplifierPointers) {
         for (auto *templateSimplifierPointer : *mTemplateSimplifierPointers) {
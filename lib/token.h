@@ -41,6 +41,7 @@
 
 struct Enumerator;
 class Function;
+class Library;
 class Scope;
 class Settings;
 class Type;
@@ -127,6 +128,27 @@ struct TokenImpl {
     };
     CppcheckAttributes* mCppcheckAttributes{};
 
+    // Parsed number literal, computed on first use and discarded when the token string changes
+    struct NumberLiteral {
+        bool isInt{};
+        bool isFloat{};
+        bool hasIntValue{};
+        bool hasDoubleValue{};
+        MathLib::bigint intValue{};
+        double doubleValue{};
+    };
+    NumberLiteral* mNumberLiteral{};
+
+    // Library lookups for a function call token, computed on first use when the token list is final
+    struct LibraryFunction {
+        const Library* library{};
+        bool hasFunctionName{};
+        bool hasNotLibraryFunction{};
+        bool notLibraryFunction{};
+        std::string functionName;
+    };
+    LibraryFunction* mLibraryFunction{};
+
     // For memoization, to speed up parsing of huge arrays #8897
     enum class Cpp11init { UNKNOWN, CPP11INIT, NOINIT } mCpp11init = Cpp11init::UNKNOWN;
 
@@ -181,6 +203,8 @@ public:
     void str(T&& s) {
         mStr = s;
         mImpl->mVarId = 0;
+        delete mImpl->mNumberLiteral;
+        mImpl->mNumberLiteral = nullptr;
 
         update_property_info();
     }
@@ -377,6 +401,18 @@ public:
     bool isNumber() const {
         return mTokType == eNumber;
     }
+    /** Same as isNumber() && MathLib::isInt(str()), the result is cached */
+    bool isIntNumber() const {
+        return mTokType == eNumber && numberLiteral().isInt;
+    }
+    /** Same as isNumber() && MathLib::isFloat(str()), the result is cached */
+    bool isFloatNumber() const {
+        return mTokType == eNumber && numberLiteral().isFloat;
+    }
+    /** Same as MathLib::toLongNumber(str()), the result is cached for number and char literals */
+    MathLib::bigint toLongNumber() const;
+    /** Same as MathLib::toDoubleNumber(str()), the result is cached for number and char literals */
+    double toDoubleNumber() const;
     bool isEnumerator() const {
         return mTokType == eEnumerator;
     }
@@ -1063,6 +1099,13 @@ public:
         return mTokType == eFunction || mTokType == eLambda ? mImpl->mFunction : nullptr;
     }
 
+    /**
+     * Cached library lookups for this token, used by Library.
+     * @param library the library that does the lookups
+     * @return the cache, or nullptr when the token list is not final yet
+     */
+    TokenImpl::LibraryFunction* libraryFunction(const Library *library) const;
+
     /**
      * Associate this token with given variable
      * @param v Variable to be associated
@@ -1362,6 +1405,9 @@ private:
         Called after any mStr() modification. */
     void update_property_info();
 
+    /** Parsed number literal of this token, created on first use */
+    TokenImpl::NumberLiteral& numberLiteral() const;
+
     /** Update internal property cache about isStandardType() */
     void update_property_isStandardType();
 
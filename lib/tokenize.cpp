@@ -45,6 +45,7 @@
 #include <iostream>
 #include <iterator>
 #include <exception>
+#include <functional>
 #include <memory>
 #include <set>
 #include <sstream> // IWYU pragma: keep
@@ -405,6 +406,50 @@ namespace {
         bool isNamespace{};
         std::set<std::string> recordTypes;
     };
+
+    /**
+     * Number of name tokens per name in the token list. A typedef whose name only
+     * occurs in its own declaration can't be used anywhere so there is no need to
+     * scan the rest of the token list for it.
+     * The counts are an upper bound: removed tokens are not subtracted and names that
+     * might get copied into the token list are tracked as "unknown".
+     */
+    class TypedefNameIndex {
+    public:
+        explicit TypedefNameIndex(const Token *start) {
+            for (const Token *tok = start; tok; tok = tok->next()) {
+                if (tok->isName())
+                    ++mCount[tok->str()];
+            }
+        }
+
+        /** Can there be any usage of the typedef name besides the declaration? */
+        bool mayBeUsed(const std::string &name) const {
+            if (mUnknown.find(name) != mUnknown.end())
+                return true;
+            const std::unordered_map<std::string, int>::const_iterator it = mCount.find(name);
+            return it != mCount.end() && it->second > 1;
+        }
+
+        /** A token with this name has been (or might be) inserted */
+        void inserted(const std::string &name) {
+            mUnknown.insert(name);
+        }
+
+        /** Tokens in the range [start,end] have (or might have) been copied */
+        void copied(const Token *start, const Token *end) {
+            for (const Token *tok = start; tok; tok = tok->next()) {
+                if (tok->isName())
+                    mUnknown.insert(tok->str());
+                if (tok == end)
+                    break;
+            }
+        }
+
+    private:
+        std::unordered_map<std::string, int> mCount;
+        std::unordered_set<std::string> mUnknown;
+    };
 }
 
 static Token *splitDefinitionFromTypedef(Token *tok, nonneg int *unnamedCount)
@@ -1118,6 +1163,8 @@ void Tokenizer::simplifyTypedefCpp()
     // Convert "using a::b;" to corresponding typedef statements
     simplifyUsingToTypedef();
 
+    TypedefNameIndex nameIndex(list.front());
+
     const std::time_t maxTime = mSettings->typedefMaxTime > 0 ? std::time(nullptr) + mSettings->typedefMaxTime: 0;
 
     for (Token *tok = list.front(); tok; tok = tok->next()) {
@@ -1190,6 +1237,7 @@ void Tokenizer::simplifyTypedefCpp()
             if (!tok1)
                 continue;
             tok = tok1;
+            nameIndex.copied(tok, tok->tokAt(3));
         }
 
         /** @todo add support for union */
@@ -1610,7 +1658,10 @@ void Tokenizer::simplifyTypedefCpp()
                 classPath += spaceInfo[i].className;
             }
 
-            for (Token *tok2 = tok; tok2; tok2 = tok2->next()) {
+            // there is nothing to replace if the name is not used
+            Token * const scanStart = nameIndex.mayBeUsed(typeName->str()) ? tok : nullptr;
+
+            for (Token *tok2 = scanStart; tok2; tok2 = tok2->next()) {
                 if (Settings::terminated())
                     return;
 
@@ -2281,6 +2332,13 @@ void Tokenizer::simplifyTypedefCpp()
             if (!tok)
                 syntaxError(nullptr);
 
+            if (mTypedefInfo.back().used) {
+                // the replacements are copies of the typedef tokens and class names
+                nameIndex.copied(typeDef, tok);
+                for (const Space &space : spaceInfo)
+                    nameIndex.inserted(space.className);
+            }
+
             if (tok->str() == ";")
                 done = true;
             else if (tok->str() == ",") {
@@ -3346,6 +3404,9 @@ bool Tokenizer::simplifyTokens1(const std::string &configuration)
         mSymbolDatabase->setValueTypeInTokenList(true);
     }
 
+    // ValueFlow and the checks do not change the AST or the symbol database information in the tokens
+    list.setFinal();
+
     if (!mSettings->buildDir.empty())
         Summaries::create(this, configuration);
 
@@ -4014,8 +4075,8 @@ void Tokenizer::simplifyTemplates()
 /** Class used in Tokenizer::setVarIdPass1 */
 class VariableMap {
 private:
-    std::map<std::string, nonneg int> mVariableId;
-    std::map<std::string, nonneg int> mVariableId_global;
+    std::unordered_map<std::string, nonneg int> mVariableId;
+    std::unordered_map<std::string, nonneg int> mVariableId_global;
     std::stack<std::vector<std::pair<std::string, nonneg int>>> mScopeInfo;
     mutable nonneg int mVarId{};
 public:
@@ -4027,7 +4088,7 @@ public:
         return mVariableId.find(varname) != mVariableId.end();
     }
 
-    const std::map<std::string, nonneg int>& map(bool global) const {
+    const std::unordered_map<std::string, nonneg int>& map(bool global) const {
         return global ? mVariableId_global : mVariableId;
     }
     nonneg int getVarId() const {
@@ -4067,7 +4128,7 @@ void VariableMap::addVariable(const std::string& varname, bool globalNamespace)
             mVariableId_global[varname] = mVariableId[varname];
         return;
     }
-    std::map<std::string, nonneg int>::iterator it = mVariableId.find(varname);
+    std::unordered_map<std::string, nonneg int>::iterator it = mVariableId.find(varname);
     if (it == mVariableId.end()) {
         mScopeInfo.top().emplace_back(varname, 0);
         mVariableId[varname] = ++mVarId;
@@ -4222,7 +4283,7 @@ static bool setVarIdParseDeclaration(Token** tok, const VariableMap& variableMap
 
 
 void Tokenizer::setVarIdStructMembers(Token **tok1,
-                                      std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers,
+                                      std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers,
                                       nonneg int &varId) const
 {
     Token *tok = *tok1;
@@ -4232,7 +4293,7 @@ void Tokenizer::setVarIdStructMembers(Token **tok1,
         if (struct_varid == 0)
             return;
 
-        std::map<std::string, nonneg int>& members = structMembers[struct_varid];
+        std::unordered_map<std::string, nonneg int>& members = structMembers[struct_varid];
 
         tok = tok->tokAt(3);
         while (tok->str() != "}") {
@@ -4240,7 +4301,7 @@ void Tokenizer::setVarIdStructMembers(Token **tok1,
                 tok = tok->link();
             if (Token::Match(tok->previous(), "[,{] . %name% =|{")) {
                 tok = tok->next();
-                const std::map<std::string, nonneg int>::iterator it = members.find(tok->str());
+                const std::unordered_map<std::string, nonneg int>::iterator it = members.find(tok->str());
                 if (it == members.end()) {
                     members[tok->str()] = ++varId;
                     tok->varId(varId);
@@ -4273,8 +4334,8 @@ void Tokenizer::setVarIdStructMembers(Token **tok1,
         if (TemplateSimplifier::templateParameters(tok->next()) > 0)
             break;
 
-        std::map<std::string, nonneg int>& members = structMembers[struct_varid];
-        const std::map<std::string, nonneg int>::iterator it = members.find(tok->str());
+        std::unordered_map<std::string, nonneg int>& members = structMembers[struct_varid];
+        const std::unordered_map<std::string, nonneg int>::iterator it = members.find(tok->str());
         if (it == members.end()) {
             members[tok->str()] = ++varId;
             tok->varId(varId);
@@ -4289,7 +4350,7 @@ void Tokenizer::setVarIdStructMembers(Token **tok1,
 void Tokenizer::setVarIdClassDeclaration(Token* const startToken,
                                          VariableMap& variableMap,
                                          const nonneg int scopeStartVarId,
-                                         std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers)
+                                         std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers)
 {
     // end of scope
     const Token* const endToken = startToken->link();
@@ -4330,7 +4391,7 @@ void Tokenizer::setVarIdClassDeclaration(Token* const startToken,
             --indentlevel;
             inEnum = false;
         } else if (initList && indentlevel == 0 && Token::Match(tok->previous(), "[,:] %name% [({]")) {
-            const std::map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
+            const std::unordered_map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
             if (it != variableMap.map(false).end()) {
                 tok->varId(it->second);
             }
@@ -4348,7 +4409,7 @@ void Tokenizer::setVarIdClassDeclaration(Token* const startToken,
                 }
 
                 if (!inEnum) {
-                    const std::map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
+                    const std::unordered_map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
                     if (it != variableMap.map(false).end()) {
                         tok->varId(it->second);
                         setVarIdStructMembers(&tok, structMembers, variableMap.getVarId());
@@ -4367,14 +4428,15 @@ void Tokenizer::setVarIdClassDeclaration(Token* const startToken,
 void Tokenizer::setVarIdClassFunction(const std::string &classname,
                                       Token * const startToken,
                                       const Token * const endToken,
-                                      const std::map<std::string, nonneg int> &varlist,
-                                      std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers,
+                                      const std::unordered_map<std::string, nonneg int> &varlist,
+                                      std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers,
                                       nonneg int &varId_)
 {
+    const std::string classnamePattern("!!" + classname + " ::");
     for (Token *tok2 = startToken; tok2 && tok2 != endToken; tok2 = tok2->next()) {
         if (tok2->varId() != 0 || !tok2->isName())
             continue;
-        if (Token::Match(tok2->tokAt(-2), ("!!" + classname + " ::").c_str()))
+        if (Token::Match(tok2->tokAt(-2), classnamePattern.c_str()))
             continue;
         if (Token::Match(tok2->tokAt(-4), "%name% :: %name% ::")) // Currently unsupported
             continue;
@@ -4383,7 +4445,7 @@ void Tokenizer::setVarIdClassFunction(const std::string &classname,
         if (Token::Match(tok2, "%name% ::"))
             continue;
 
-        const std::map<std::string, nonneg int>::const_iterator it = varlist.find(tok2->str());
+        const std::unordered_map<std::string, nonneg int>::const_iterator it = varlist.find(tok2->str());
         if (it != varlist.end()) {
             tok2->varId(it->second);
             setVarIdStructMembers(&tok2, structMembers, varId_);
@@ -4422,7 +4484,7 @@ void Tokenizer::setVarIdPass1()
     const std::unordered_set<std::string>& notstart = (isC()) ? notstart_c : notstart_cpp;
 
     VariableMap variableMap;
-    std::map<nonneg int, std::map<std::string, nonneg int>> structMembers;
+    std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>> structMembers;
 
     std::stack<VarIdScopeInfo> scopeStack;
 
@@ -4692,7 +4754,7 @@ void Tokenizer::setVarIdPass1()
                         while (tok != end) {
                             if (tok->isName() && !(Token::simpleMatch(tok->next(), "<") &&
                                                    Token::Match(tok->tokAt(-1), ":: %name%"))) {
-                                const std::map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
+                                const std::unordered_map<std::string, nonneg int>::const_iterator it = variableMap.map(false).find(tok->str());
                                 if (it != variableMap.map(false).end())
                                     tok->varId(it->second);
                             }
@@ -4757,7 +4819,7 @@ void Tokenizer::setVarIdPass1()
 
             if ((!scopeStack.top().isEnum || !(Token::Match(tok->previous(), "{|,") && Token::Match(tok->next(), ",|=|}"))) &&
                 !Token::simpleMatch(tok->next(), ": ;")) {
-                const std::map<std::string, nonneg int>::const_iterator it = variableMap.map(globalNamespace).find(tok->str());
+                const std::unordered_map<std::string, nonneg int>::const_iterator it = variableMap.map(globalNamespace).find(tok->str());
                 if (it != variableMap.map(globalNamespace).end()) {
                     tok->varId(it->second);
                     setVarIdStructMembers(&tok, structMembers, variableMap.getVarId());
@@ -4878,9 +4940,44 @@ static Token * matchMemberFunctionName(const Member &func, const std::list<Scope
     return Token::Match(tok, "~| %name% (") ? tok : nullptr;
 }
 
+/** Out of line members, by the names that can be the innermost class name when they match */
+using MemberIndex = std::unordered_map<std::string, std::vector<const Member *>>;
+
+static MemberIndex indexMembers(const std::list<Member> &members)
+{
+    MemberIndex index;
+    std::vector<std::string> names;
+    for (const Member &member : members) {
+        // The member matches a class when the class name is the last name of
+        // the namespace, the last name of a "using namespace", or a qualifier.
+        names.clear();
+        if (!member.scope.empty())
+            names.push_back(member.scope.back());
+        for (const Token *ns : member.usingnamespaces) {
+            while (Token::Match(ns, "%name% ::"))
+                ns = ns->tokAt(2);
+            names.push_back(ns->str());
+        }
+        for (const Token *tok = member.tok; Token::Match(tok, "%name% ::|<");) {
+            names.push_back(tok->str());
+            if (tok->next()->str() == "<") {
+                tok = tok->next()->findClosingBracket();
+                if (!Token::simpleMatch(tok, "> ::"))
+                    break;
+            }
+            tok = tok->tokAt(2);
+        }
+        std::sort(names.begin(), names.end());
+        names.erase(std::unique(names.begin(), names.end()), names.end());
+        for (const std::string &name : names)
+            index[name].push_back(&member);
+    }
+    return index;
+}
+
 void Tokenizer::setVarIdPass2()
 {
-    std::map<nonneg int, std::map<std::string, nonneg int>> structMembers;
+    std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>> structMembers;
 
     // Member functions and variables in this source
     std::list<Member> allMemberFunctions;
@@ -4945,10 +5042,13 @@ void Tokenizer::setVarIdPass2()
         }
     }
 
+    const MemberIndex memberFunctionsByName = indexMembers(allMemberFunctions);
+    const MemberIndex memberVarsByName = indexMembers(allMemberVars);
+
     std::list<ScopeInfo2> scopeInfo;
 
     // class members..
-    std::map<std::string, std::map<std::string, nonneg int>> varsByClass;
+    std::unordered_map<std::string, std::unordered_map<std::string, nonneg int>> varsByClass;
     for (Token *tok = list.front(); tok; tok = tok->next()) {
         while (tok->str() == "}" && !scopeInfo.empty() && tok == scopeInfo.back().bodyEnd)
             scopeInfo.pop_back();
@@ -4979,7 +5079,7 @@ void Tokenizer::setVarIdPass2()
         for (const Token *it : classnameTokens)
             classname += (classname.empty() ? "" : " :: ") + it->str();
 
-        std::map<std::string, nonneg int> &thisClassVars = varsByClass[scopeName2 + classname];
+        std::unordered_map<std::string, nonneg int> &thisClassVars = varsByClass[scopeName2 + classname];
         while (Token::Match(tokStart, ":|::|,|%name%")) {
             if (Token::Match(tokStart, "%name% <")) { // TODO: why skip templates?
                 tokStart = tokStart->next()->findClosingBracket();
@@ -5010,7 +5110,7 @@ void Tokenizer::setVarIdPass2()
                         break;
                     scopeName3.erase(pos + 4);
                 }
-                const std::map<std::string, nonneg int>& baseClassVars = varsByClass[baseClassName];
+                const std::unordered_map<std::string, nonneg int>& baseClassVars = varsByClass[baseClassName];
                 thisClassVars.insert(baseClassVars.cbegin(), baseClassVars.cend());
             }
             tokStart = tokStart->next();
@@ -5057,20 +5157,26 @@ void Tokenizer::setVarIdPass2()
             continue;
 
         // Member variables
-        for (const Member &var : allMemberVars) {
-            Token *tok2 = matchMemberVarName(var, scopeInfo);
-            if (!tok2)
-                continue;
-            if (tok2->varId() == 0)
-                tok2->varId(thisClassVars[tok2->str()]);
+        const MemberIndex::const_iterator vars = memberVarsByName.find(scopeInfo.back().name);
+        if (vars != memberVarsByName.cend()) {
+            for (const Member *var : vars->second) {
+                Token *tok2 = matchMemberVarName(*var, scopeInfo);
+                if (!tok2)
+                    continue;
+                if (tok2->varId() == 0)
+                    tok2->varId(thisClassVars[tok2->str()]);
+            }
         }
 
         if (isC() || tok->str() == "namespace")
             continue;
 
         // Set variable ids in member functions for this class..
-        for (const Member &func : allMemberFunctions) {
-            Token *tok2 = matchMemberFunctionName(func, scopeInfo);
+        const MemberIndex::const_iterator funcs = memberFunctionsByName.find(scopeInfo.back().name);
+        if (funcs == memberFunctionsByName.cend())
+            continue;
+        for (const Member *func : funcs->second) {
+            Token *tok2 = matchMemberFunctionName(*func, scopeInfo);
             if (!tok2)
                 continue;
 
@@ -5103,7 +5209,7 @@ void Tokenizer::setVarIdPass2()
                     break;
 
                 // set varid
-                const std::map<std::string, nonneg int>::const_iterator varpos = thisClassVars.find(tok3->str());
+                const std::unordered_map<std::string, nonneg int>::const_iterator varpos = thisClassVars.find(tok3->str());
                 if (varpos != thisClassVars.end())
                     tok3->varId(varpos->second);
 
@@ -5323,259 +5429,271 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     if (Settings::terminated())
         return false;
 
+    // run a simplification, its time is reported separately by --showtime
+    const auto runPass = [this](const char name[], const std::function<void()> &pass) {
+        if (mTimerResults) {
+            Timer t(std::string("Tokenizer::simplifyTokens1::simplifyTokenList1::") + name, mSettings->showtime, mTimerResults);
+            pass();
+        } else {
+            pass();
+        }
+    };
+
     // if MACRO
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (Token::Match(tok, "if|for|while|BOOST_FOREACH %name% (")) {
-            if (Token::simpleMatch(tok, "for each")) {
-                // 'for each ( )' -> 'asm ( )'
-                tok->str("asm");
-                tok->deleteNext();
-            } else if (tok->strAt(1) == "constexpr") {
-                tok->deleteNext();
-                tok->isConstexpr(true);
-            } else {
-                syntaxError(tok);
+    runPass("ifMacro", [this] {
+        for (Token *tok = list.front(); tok; tok = tok->next()) {
+            if (Token::Match(tok, "if|for|while|BOOST_FOREACH %name% (")) {
+                if (Token::simpleMatch(tok, "for each")) {
+                    // 'for each ( )' -> 'asm ( )'
+                    tok->str("asm");
+                    tok->deleteNext();
+                } else if (tok->strAt(1) == "constexpr") {
+                    tok->deleteNext();
+                    tok->isConstexpr(true);
+                } else {
+                    syntaxError(tok);
+                }
             }
         }
-    }
+    });
 
     // Is there C++ code in C file?
-    validateC();
+    runPass("validateC", [this] { validateC(); });
 
     // Combine strings and character literals, e.g. L"string", L'c', "string1" "string2"
-    combineStringAndCharLiterals();
+    runPass("combineStringAndCharLiterals", [this] { combineStringAndCharLiterals(); });
 
     // replace inline SQL with "asm()" (Oracle PRO*C). Ticket: #1959
-    simplifySQL();
+    runPass("simplifySQL", [this] { simplifySQL(); });
 
-    createLinks();
+    runPass("createLinks", [this] { createLinks(); });
 
     // Simplify debug intrinsics
-    simplifyDebug();
+    runPass("simplifyDebug", [this] { simplifyDebug(); });
 
-    removePragma();
+    runPass("removePragma", [this] { removePragma(); });
 
     // Simplify the C alternative tokens (and, or, etc.)
-    simplifyCAlternativeTokens();
+    runPass("simplifyCAlternativeTokens", [this] { simplifyCAlternativeTokens(); });
 
-    simplifyFunctionTryCatch();
+    runPass("simplifyFunctionTryCatch", [this] { simplifyFunctionTryCatch(); });
 
-    simplifyHeadersAndUnusedTemplates();
+    runPass("simplifyHeadersAndUnusedTemplates", [this] { simplifyHeadersAndUnusedTemplates(); });
 
     // Remove __asm..
-    simplifyAsm();
+    runPass("simplifyAsm", [this] { simplifyAsm(); });
 
     // foo < bar < >> => foo < bar < > >
     if (isCPP() || mSettings->daca)
-        splitTemplateRightAngleBrackets(!isCPP());
+        runPass("splitTemplateRightAngleBrackets", [this] { splitTemplateRightAngleBrackets(!isCPP()); });
 
     // Remove extra "template" tokens that are not used by cppcheck
-    removeExtraTemplateKeywords();
+    runPass("removeExtraTemplateKeywords", [this] { removeExtraTemplateKeywords(); });
 
-    simplifySpaceshipOperator();
+    runPass("simplifySpaceshipOperator", [this] { simplifySpaceshipOperator(); });
 
     // Bail out if code is garbage
-    if (mTimerResults) {
-        Timer t("Tokenizer::simplifyTokens1::simplifyTokenList1::findGarbageCode", mSettings->showtime, mTimerResults);
-        findGarbageCode();
-    } else {
-        findGarbageCode();
-    }
+    runPass("findGarbageCode", [this] { findGarbageCode(); });
 
-    checkConfiguration();
+    runPass("checkConfiguration", [this] { checkConfiguration(); });
 
     // if (x) MACRO() ..
-    for (const Token *tok = list.front(); tok; tok = tok->next()) {
-        if (Token::simpleMatch(tok, "if (")) {
-            tok = tok->next()->link();
-            if (Token::Match(tok, ") %name% (") &&
-                tok->next()->isUpperCaseName() &&
-                Token::Match(tok->linkAt(2), ") {|else")) {
-                syntaxError(tok->next());
+    runPass("ifMacroCall", [this] {
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            if (Token::simpleMatch(tok, "if (")) {
+                tok = tok->next()->link();
+                if (Token::Match(tok, ") %name% (") &&
+                    tok->next()->isUpperCaseName() &&
+                    Token::Match(tok->linkAt(2), ") {|else")) {
+                    syntaxError(tok->next());
+                }
             }
         }
-    }
+    });
 
     if (Settings::terminated())
         return false;
 
     // convert C++17 style nested namespaces to old style namespaces
-    simplifyNestedNamespace();
+    runPass("simplifyNestedNamespace", [this] { simplifyNestedNamespace(); });
 
     // convert c++20 coroutines
-    simplifyCoroutines();
+    runPass("simplifyCoroutines", [this] { simplifyCoroutines(); });
 
     // simplify namespace aliases
-    simplifyNamespaceAliases();
-
-    // Remove [[attribute]]
-    simplifyCPPAttribute();
-
-    // remove __attribute__((?))
-    simplifyAttribute();
+    runPass("simplifyNamespaceAliases", [this] { simplifyNamespaceAliases(); });
 
-    // simplify cppcheck attributes __cppcheck_?__(?)
-    simplifyCppcheckAttribute();
+    // Remove [[attribute]], __attribute__((?)) and cppcheck attributes __cppcheck_?__(?)
+    runPass("removeAttributes", [this] { removeAttributes(); });
 
     // Combine tokens..
-    combineOperators();
+    runPass("combineOperators", [this] { combineOperators(); });
 
     // combine "- %num%"
-    concatenateNegativeNumberAndAnyPositive();
+    runPass("concatenateNegativeNumberAndAnyPositive", [this] { concatenateNegativeNumberAndAnyPositive(); });
 
     // remove extern "C" and extern "C" {}
     if (isCPP())
-        simplifyExternC();
+        runPass("simplifyExternC", [this] { simplifyExternC(); });
 
     // simplify weird but legal code: "[;{}] ( { code; } ) ;"->"[;{}] code;"
-    simplifyRoundCurlyParentheses();
+    runPass("simplifyRoundCurlyParentheses", [this] { simplifyRoundCurlyParentheses(); });
 
     // check for simple syntax errors..
-    for (const Token *tok = list.front(); tok; tok = tok->next()) {
-        if (Token::simpleMatch(tok, "> struct {") &&
-            Token::simpleMatch(tok->linkAt(2), "} ;")) {
-            syntaxError(tok);
+    runPass("structAfterTemplate", [this] {
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            if (Token::simpleMatch(tok, "> struct {") &&
+                Token::simpleMatch(tok->linkAt(2), "} ;")) {
+                syntaxError(tok);
+            }
         }
-    }
+    });
 
-    if (!simplifyAddBraces())
+    bool addedBraces = false;
+    runPass("simplifyAddBraces", [this, &addedBraces] { addedBraces = simplifyAddBraces(); });
+    if (!addedBraces)
         return false;
 
-    sizeofAddParentheses();
+    runPass("sizeofAddParentheses", [this] { sizeofAddParentheses(); });
 
     // Simplify: 0[foo] -> *(foo)
-    for (Token* tok = list.front(); tok; tok = tok->next()) {
-        if (Token::simpleMatch(tok, "0 [") && tok->linkAt(1)) {
-            tok->str("*");
-            tok->next()->str("(");
-            tok->linkAt(1)->str(")");
+    runPass("zeroIndex", [this] {
+        for (Token* tok = list.front(); tok; tok = tok->next()) {
+            if (Token::simpleMatch(tok, "0 [") && tok->linkAt(1)) {
+                tok->str("*");
+                tok->next()->str("(");
+                tok->linkAt(1)->str(")");
+            }
         }
-    }
+    });
 
     if (Settings::terminated())
         return false;
 
     // Remove __declspec()
-    simplifyDeclspec();
-    validate();
+    runPass("simplifyDeclspec", [this] { simplifyDeclspec(); });
+    runPass("validate1", [this] { validate(); });
 
     // Remove "inline", "register", and "restrict"
-    simplifyKeyword();
+    runPass("simplifyKeyword", [this] { simplifyKeyword(); });
 
     // simplify simple calculations inside <..>
     if (isCPP()) {
-        Token *lt = nullptr;
-        for (Token *tok = list.front(); tok; tok = tok->next()) {
-            if (Token::Match(tok, "[;{}]"))
-                lt = nullptr;
-            else if (Token::Match(tok, "%type% <"))
-                lt = tok->next();
-            else if (lt && Token::Match(tok, ">|>> %name%|::|(")) {
-                const Token * const end = tok;
-                for (tok = lt; tok != end; tok = tok->next()) {
-                    if (tok->isNumber())
-                        TemplateSimplifier::simplifyNumericCalculations(tok);
+        runPass("templateArgumentCalculations", [this] {
+            Token *lt = nullptr;
+            for (Token *tok = list.front(); tok; tok = tok->next()) {
+                if (Token::Match(tok, "[;{}]"))
+                    lt = nullptr;
+                else if (Token::Match(tok, "%type% <"))
+                    lt = tok->next();
+                else if (lt && Token::Match(tok, ">|>> %name%|::|(")) {
+                    const Token * const end = tok;
+                    for (tok = lt; tok != end; tok = tok->next()) {
+                        if (tok->isNumber())
+                            TemplateSimplifier::simplifyNumericCalculations(tok);
+                    }
+                    lt = tok->next();
                 }
-                lt = tok->next();
             }
-        }
+        });
     }
 
     // Convert K&R function declarations to modern C
-    simplifyVarDecl(true);
-    simplifyFunctionParameters();
+    runPass("simplifyVarDecl1", [this] { simplifyVarDecl(true); });
+    runPass("simplifyFunctionParameters", [this] { simplifyFunctionParameters(); });
 
     // simplify case ranges (gcc extension)
-    simplifyCaseRange();
+    runPass("simplifyCaseRange", [this] { simplifyCaseRange(); });
 
     // simplify labels and 'case|default'-like syntaxes
-    simplifyLabelsCaseDefault();
+    runPass("simplifyLabelsCaseDefault", [this] { simplifyLabelsCaseDefault(); });
 
     if (!isC() && !mSettings->library.markupFile(FileName)) {
-        findComplicatedSyntaxErrorsInTemplates();
+        runPass("findComplicatedSyntaxErrorsInTemplates", [this] { findComplicatedSyntaxErrorsInTemplates(); });
     }
 
     if (Settings::terminated())
         return false;
 
     // remove calling conventions __cdecl, __stdcall..
-    simplifyCallingConvention();
+    runPass("simplifyCallingConvention", [this] { simplifyCallingConvention(); });
 
-    addSemicolonAfterUnknownMacro();
+    runPass("addSemicolonAfterUnknownMacro", [this] { addSemicolonAfterUnknownMacro(); });
 
     // remove some unhandled macros in global scope
-    removeMacrosInGlobalScope();
+    runPass("removeMacrosInGlobalScope", [this] { removeMacrosInGlobalScope(); });
 
     // remove undefined macro in class definition:
     // class DLLEXPORT Fred { };
     // class Fred FINAL : Base { };
-    removeMacroInClassDef();
+    runPass("removeMacroInClassDef", [this] { removeMacroInClassDef(); });
 
     // That call here fixes #7190
-    validate();
+    runPass("validate2", [this] { validate(); });
 
     // remove unnecessary member qualification..
-    removeUnnecessaryQualification();
+    runPass("removeUnnecessaryQualification", [this] { removeUnnecessaryQualification(); });
 
     // convert Microsoft memory functions
-    simplifyMicrosoftMemoryFunctions();
+    runPass("simplifyMicrosoftMemoryFunctions", [this] { simplifyMicrosoftMemoryFunctions(); });
 
     // convert Microsoft string functions
-    simplifyMicrosoftStringFunctions();
+    runPass("simplifyMicrosoftStringFunctions", [this] { simplifyMicrosoftStringFunctions(); });
 
     if (Settings::terminated())
         return false;
 
     // remove Borland stuff..
-    simplifyBorland();
+    runPass("simplifyBorland", [this] { simplifyBorland(); });
 
     // syntax error: enum with typedef in it
-    checkForEnumsWithTypedef();
+    runPass("checkForEnumsWithTypedef", [this] { checkForEnumsWithTypedef(); });
 
     // Add parentheses to ternary operator where necessary
-    prepareTernaryOpForAST();
+    runPass("prepareTernaryOpForAST1", [this] { prepareTernaryOpForAST(); });
 
     // Change initialisation of variable to assignment
-    simplifyInitVar();
+    runPass("simplifyInitVar1", [this] { simplifyInitVar(); });
 
     // Split up variable declarations.
-    simplifyVarDecl(false);
+    runPass("simplifyVarDecl2", [this] { simplifyVarDecl(false); });
 
-    reportUnknownMacros();
+    runPass("reportUnknownMacros", [this] { reportUnknownMacros(); });
 
-    simplifyTypedefLHS();
+    runPass("simplifyTypedefLHS", [this] { simplifyTypedefLHS(); });
 
     // typedef..
-    if (mTimerResults) {
-        Timer t("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTypedef", mSettings->showtime, mTimerResults);
-        simplifyTypedef();
-    } else {
-        simplifyTypedef();
-    }
+    runPass("simplifyTypedef", [this] { simplifyTypedef(); });
 
     // using A = B;
-    while (simplifyUsing())
-        ;
+    runPass("simplifyUsing", [this] {
+        while (simplifyUsing())
+            ;
+    });
 
     // Add parentheses to ternary operator where necessary
     // TODO: this is only necessary if one typedef simplification had a comma and was used within ?:
     // If typedef handling is refactored and moved to symboldatabase someday we can remove this
-    prepareTernaryOpForAST();
+    runPass("prepareTernaryOpForAST2", [this] { prepareTernaryOpForAST(); });
 
-    for (Token* tok = list.front(); tok;) {
-        if (Token::Match(tok, "union|struct|class union|struct|class"))
-            tok->deleteNext();
-        else
-            tok = tok->next();
-    }
+    runPass("duplicateClassKeyword", [this] {
+        for (Token* tok = list.front(); tok;) {
+            if (Token::Match(tok, "union|struct|class union|struct|class"))
+                tok->deleteNext();
+            else
+                tok = tok->next();
+        }
+    });
 
     // class x y {
     if (isCPP() && mSettings->severity.isEnabled(Severity::information)) {
-        for (const Token *tok = list.front(); tok; tok = tok->next()) {
-            if (Token::Match(tok, "class %type% %type% [:{]")) {
-                unhandled_macro_class_x_y(tok);
+        runPass("unhandledMacroClassXY", [this] {
+            for (const Token *tok = list.front(); tok; tok = tok->next()) {
+                if (Token::Match(tok, "class %type% %type% [:{]")) {
+                    unhandled_macro_class_x_y(tok);
+                }
             }
-        }
+        });
     }
 
     // catch bad typedef canonicalization
@@ -5583,159 +5701,153 @@ bool Tokenizer::simplifyTokenList1(const char FileName[])
     // to reproduce bad typedef, download upx-ucl from:
     // http://packages.debian.org/sid/upx-ucl
     // analyse the file src/stub/src/i386-linux.elf.interp-main.c
-    validate();
+    runPass("validate3", [this] { validate(); });
 
     // The simplify enum have inner loops
     if (Settings::terminated())
         return false;
 
     // Put ^{} statements in asm()
-    simplifyAsm2();
+    runPass("simplifyAsm2", [this] { simplifyAsm2(); });
 
     // @..
-    simplifyAt();
+    runPass("simplifyAt", [this] { simplifyAt(); });
 
     // When the assembly code has been cleaned up, no @ is allowed
-    for (const Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->str() == "(") {
-            const Token *tok1 = tok;
-            tok = tok->link();
-            if (!tok)
-                syntaxError(tok1);
-        } else if (tok->str() == "@") {
-            syntaxError(tok);
+    runPass("checkAt", [this] {
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            if (tok->str() == "(") {
+                const Token *tok1 = tok;
+                tok = tok->link();
+                if (!tok)
+                    syntaxError(tok1);
+            } else if (tok->str() == "@") {
+                syntaxError(tok);
+            }
         }
-    }
+    });
 
     // Order keywords "static" and "const"
-    simplifyStaticConst();
+    runPass("simplifyStaticConst", [this] { simplifyStaticConst(); });
 
     // convert platform dependent types to standard types
     // 32 bits: size_t -> unsigned long
     // 64 bits: size_t -> unsigned long long
-    list.simplifyPlatformTypes();
+    runPass("simplifyPlatformTypes", [this] { list.simplifyPlatformTypes(); });
 
     // collapse compound standard types into a single token
     // unsigned long long int => long (with _isUnsigned=true,_isLong=true)
-    list.simplifyStdType();
+    runPass("simplifyStdType", [this] { list.simplifyStdType(); });
 
     if (Settings::terminated())
         return false;
 
     // simplify bit fields..
-    simplifyBitfields();
+    runPass("simplifyBitfields", [this] { simplifyBitfields(); });
 
     if (Settings::terminated())
         return false;
 
     // struct simplification "struct S {} s; => struct S { } ; S s ;
-    simplifyStructDecl();
+    runPass("simplifyStructDecl", [this] { simplifyStructDecl(); });
 
     if (Settings::terminated())
         return false;
 
     // x = ({ 123; });  =>   { x = 123; }
-    simplifyAssignmentBlock();
+    runPass("simplifyAssignmentBlock", [this] { simplifyAssignmentBlock(); });
 
     if (Settings::terminated())
         return false;
 
-    simplifyVariableMultipleAssign();
+    runPass("simplifyVariableMultipleAssign", [this] { simplifyVariableMultipleAssign(); });
 
     // Collapse operator name tokens into single token
     // operator = => operator=
-    simplifyOperatorName();
+    runPass("simplifyOperatorName", [this] { simplifyOperatorName(); });
 
     // Remove redundant parentheses
-    simplifyRedundantParentheses();
+    runPass("simplifyRedundantParentheses", [this] { simplifyRedundantParentheses(); });
 
     if (isCPP())
-        simplifyTypeIntrinsics();
+        runPass("simplifyTypeIntrinsics", [this] { simplifyTypeIntrinsics(); });
 
     if (!isC()) {
         // Handle templates..
-        if (mTimerResults) {
-            Timer t("Tokenizer::simplifyTokens1::simplifyTokenList1::simplifyTemplates", mSettings->showtime, mTimerResults);
-            simplifyTemplates();
-        } else {
-            simplifyTemplates();
-        }
+        runPass("simplifyTemplates", [this] { simplifyTemplates(); });
 
         // The simplifyTemplates have inner loops
         if (Settings::terminated())
             return false;
 
-        validate(); // #6847 - invalid code
+        runPass("validate4", [this] { validate(); }); // #6847 - invalid code
     }
 
     // Simplify pointer to standard types (C only)
-    simplifyPointerToStandardType();
+    runPass("simplifyPointerToStandardType", [this] { simplifyPointerToStandardType(); });
 
     // simplify function pointers
-    simplifyFunctionPointers();
+    runPass("simplifyFunctionPointers", [this] { simplifyFunctionPointers(); });
 
     // Change initialisation of variable to assignment
-    simplifyInitVar();
+    runPass("simplifyInitVar2", [this] { simplifyInitVar(); });
 
     // Split up variable declarations.
-    simplifyVarDecl(false);
+    runPass("simplifyVarDecl3", [this] { simplifyVarDecl(false); });
 
-    elseif();
+    runPass("elseif", [this] { elseif(); });
 
-    validate(); // #6772 "segmentation fault (invalid code) in Tokenizer::setVarId"
+    runPass("validate5", [this] { validate(); }); // #6772 "segmentation fault (invalid code) in Tokenizer::setVarId"
 
-    if (mTimerResults) {
-        Timer t("Tokenizer::simplifyTokens1::simplifyTokenList1::setVarId", mSettings->showtime, mTimerResults);
-        setVarId();
-    } else {
-        setVarId();
-    }
+    runPass("setVarId", [this] { setVarId(); });
 
     // Link < with >
-    createLinks2();
+    runPass("createLinks2", [this] { createLinks2(); });
 
     // Mark C++ casts
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (Token::Match(tok, "const_cast|dynamic_cast|reinterpret_cast|static_cast <") && Token::simpleMatch(tok->linkAt(1), "> (")) {
-            tok = tok->linkAt(1)->next();
-            tok->isCast(true);
+    runPass("markCppCasts", [this] {
+        for (Token *tok = list.front(); tok; tok = tok->next()) {
+            if (Token::Match(tok, "const_cast|dynamic_cast|reinterpret_cast|static_cast <") && Token::simpleMatch(tok->linkAt(1), "> (")) {
+                tok = tok->linkAt(1)->next();
+                tok->isCast(true);
+            }
         }
-    }
+    });
 
     // specify array size
-    arraySize();
+    runPass("arraySize", [this] { arraySize(); });
 
     // The simplify enum might have inner loops
     if (Settings::terminated())
         return false;
 
     // Add std:: in front of std classes, when using namespace std; was given
-    simplifyNamespaceStd();
+    runPass("simplifyNamespaceStd", [this] { simplifyNamespaceStd(); });
 
     // Change initialisation of variable to assignment
-    simplifyInitVar();
+    runPass("simplifyInitVar3", [this] { simplifyInitVar(); });
 
-    simplifyDoublePlusAndDoubleMinus();
+    runPass("simplifyDoublePlusAndDoubleMinus", [this] { simplifyDoublePlusAndDoubleMinus(); });
 
-    simplifyArrayAccessSyntax();
+    runPass("simplifyArrayAccessSyntax", [this] { simplifyArrayAccessSyntax(); });
 
-    Token::assignProgressValues(list.front());
+    runPass("assignProgressValues", [this] { Token::assignProgressValues(list.front()); });
 
-    removeRedundantSemicolons();
+    runPass("removeRedundantSemicolons", [this] { removeRedundantSemicolons(); });
 
-    simplifyParameterVoid();
+    runPass("simplifyParameterVoid", [this] { simplifyParameterVoid(); });
 
-    simplifyRedundantConsecutiveBraces();
+    runPass("simplifyRedundantConsecutiveBraces", [this] { simplifyRedundantConsecutiveBraces(); });
 
-    simplifyEmptyNamespaces();
+    runPass("simplifyEmptyNamespaces", [this] { simplifyEmptyNamespaces(); });
 
-    simplifyIfSwitchForInit();
+    runPass("simplifyIfSwitchForInit", [this] { simplifyIfSwitchForInit(); });
 
-    simplifyOverloadedOperators();
+    runPass("simplifyOverloadedOperators", [this] { simplifyOverloadedOperators(); });
 
-    validate();
+    runPass("validate6", [this] { validate(); });
 
-    list.front()->assignIndexes();
+    runPass("assignIndexes", [this] { list.front()->assignIndexes(); });
 
     return true;
 }
@@ -8809,194 +8921,227 @@ void Tokenizer::simplifyDeclspec()
     }
 }
 
-void Tokenizer::simplifyAttribute()
+static bool isCppcheckAttribute(const Token *tok)
 {
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (!tok->isKeyword() && Token::Match(tok, "%type% (") && !mSettings->library.isNotLibraryFunction(tok)) {
+    if (!Token::Match(tok, "%name% ("))
+        return false;
+    const std::string &attr = tok->str();
+    return attr.compare(0, 11, "__cppcheck_") == 0 && // TODO: starts_with("__cppcheck_")
+           attr.compare(attr.size()-2, 2, "__") == 0; // TODO: ends_with("__")
+}
+
+/** Delete the tokens tok..end and return the token after them. A token before tok is kept in place. */
+static Token *eraseAttribute(Token *tok, Token *end)
+{
+    Token * const next = end->next();
+    if (tok->previous()) {
+        Token::eraseTokens(tok->previous(), next);
+        return next;
+    }
+    Token::eraseTokens(tok, next);
+    tok->deleteThis();
+    return tok;
+}
+
+/** Is tok directly after another __attribute__? */
+static bool followsAttribute(const Token *tok)
+{
+    const Token * const prev = tok->previous();
+    return Token::simpleMatch(prev, ")") && prev->link() && isAttribute(prev->link()->previous(), true);
+}
+
+void Tokenizer::removeAttributes()
+{
+    // The C++11 attributes are removed first, so the other attributes never see them
+    if (isCPP() && mSettings->standards.cpp >= Standards::CPP11) {
+        for (Token *tok = list.front(); tok;) {
+            if (isCPPAttribute(tok) || isAlignAttribute(tok))
+                tok = simplifyCPPAttribute(tok);
+            else
+                tok = tok->next();
+        }
+    }
+
+    // Walk backwards, so the attributes after a token are already removed when the
+    // token is handled. A sequence of __attribute__ is handled from its first
+    // attribute, like the separate pass did.
+    for (Token *tok = list.back(); tok;) {
+        Token * const prev = tok->previous();
+        if (isAttribute(tok, true)) {
+            if (!followsAttribute(tok)) {
+                for (Token *attr = tok; isAttribute(attr, true);)
+                    attr = simplifyAttribute(attr);
+            }
+        } else if (isCppcheckAttribute(tok))
+            simplifyCppcheckAttribute(tok);
+        else if (!tok->isKeyword() && Token::Match(tok, "%type% (") && !mSettings->library.isNotLibraryFunction(tok)) {
             if (mSettings->library.isFunctionConst(tok->str(), true))
                 tok->isAttributePure(true);
             if (mSettings->library.isFunctionConst(tok->str(), false))
                 tok->isAttributeConst(true);
         }
-        while (isAttribute(tok, true)) {
-            Token *functok = getAttributeFuncTok(tok, true);
+        tok = prev;
+    }
+}
 
-            for (Token *attr = tok->tokAt(2); attr->str() != ")"; attr = attr->next()) {
-                if (Token::Match(attr, "%name% ("))
-                    attr = attr->linkAt(1);
+Token *Tokenizer::simplifyAttribute(Token *tok)
+{
+    Token *functok = getAttributeFuncTok(tok, true);
 
-                if (Token::Match(attr, "[(,] constructor|__constructor__ [,()]")) {
-                    if (!functok)
-                        syntaxError(tok);
-                    functok->isAttributeConstructor(true);
-                }
+    for (Token *attr = tok->tokAt(2); attr->str() != ")"; attr = attr->next()) {
+        if (Token::Match(attr, "%name% ("))
+            attr = attr->linkAt(1);
 
-                else if (Token::Match(attr, "[(,] destructor|__destructor__ [,()]")) {
-                    if (!functok)
-                        syntaxError(tok);
-                    functok->isAttributeDestructor(true);
-                }
+        if (Token::Match(attr, "[(,] constructor|__constructor__ [,()]")) {
+            if (!functok)
+                syntaxError(tok);
+            functok->isAttributeConstructor(true);
+        }
 
-                else if (Token::Match(attr, "[(,] unused|__unused__|used|__used__ [,)]")) {
-                    Token *vartok = nullptr;
-                    Token *after = getTokenAfterAttributes(tok, true);
+        else if (Token::Match(attr, "[(,] destructor|__destructor__ [,()]")) {
+            if (!functok)
+                syntaxError(tok);
+            functok->isAttributeDestructor(true);
+        }
 
-                    // check if after variable name
-                    if (Token::Match(after, ";|=")) {
-                        Token *prev = tok->previous();
-                        while (Token::simpleMatch(prev, "]"))
-                            prev = prev->link()->previous();
-                        if (Token::Match(prev, "%type%"))
-                            vartok = prev;
-                    }
+        else if (Token::Match(attr, "[(,] unused|__unused__|used|__used__ [,)]")) {
+            Token *vartok = nullptr;
+            Token *after = getTokenAfterAttributes(tok, true);
 
-                    // check if before variable name
-                    else if (Token::Match(after, "%type%"))
-                        vartok = after;
+            // check if after variable name
+            if (Token::Match(after, ";|=")) {
+                Token *prev = tok->previous();
+                while (Token::simpleMatch(prev, "]"))
+                    prev = prev->link()->previous();
+                if (Token::Match(prev, "%type%"))
+                    vartok = prev;
+            }
 
-                    if (vartok) {
-                        const std::string &attribute(attr->next()->str());
-                        if (attribute.find("unused") != std::string::npos)
-                            vartok->isAttributeUnused(true);
-                        else
-                            vartok->isAttributeUsed(true);
-                    }
-                }
+            // check if before variable name
+            else if (Token::Match(after, "%type%"))
+                vartok = after;
 
-                else if (Token::Match(attr, "[(,] pure|__pure__|const|__const__|noreturn|__noreturn__|nothrow|__nothrow__|warn_unused_result [,)]")) {
-                    if (!functok)
-                        syntaxError(tok);
+            if (vartok) {
+                const std::string &attribute(attr->next()->str());
+                if (attribute.find("unused") != std::string::npos)
+                    vartok->isAttributeUnused(true);
+                else
+                    vartok->isAttributeUsed(true);
+            }
+        }
 
-                    const std::string &attribute(attr->next()->str());
-                    if (attribute.find("pure") != std::string::npos)
-                        functok->isAttributePure(true);
-                    else if (attribute.find("const") != std::string::npos)
-                        functok->isAttributeConst(true);
-                    else if (attribute.find("noreturn") != std::string::npos)
-                        functok->isAttributeNoreturn(true);
-                    else if (attribute.find("nothrow") != std::string::npos)
-                        functok->isAttributeNothrow(true);
-                    else if (attribute.find("warn_unused_result") != std::string::npos)
-                        functok->isAttributeNodiscard(true);
-                }
+        else if (Token::Match(attr, "[(,] pure|__pure__|const|__const__|noreturn|__noreturn__|nothrow|__nothrow__|warn_unused_result [,)]")) {
+            if (!functok)
+                syntaxError(tok);
 
-                else if (Token::Match(attr, "[(,] packed [,)]") && Token::simpleMatch(tok->previous(), "}"))
-                    tok->previous()->isAttributePacked(true);
+            const std::string &attribute(attr->next()->str());
+            if (attribute.find("pure") != std::string::npos)
+                functok->isAttributePure(true);
+            else if (attribute.find("const") != std::string::npos)
+                functok->isAttributeConst(true);
+            else if (attribute.find("noreturn") != std::string::npos)
+                functok->isAttributeNoreturn(true);
+            else if (attribute.find("nothrow") != std::string::npos)
+                functok->isAttributeNothrow(true);
+            else if (attribute.find("warn_unused_result") != std::string::npos)
+                functok->isAttributeNodiscard(true);
+        }
 
-                else if (functok && Token::simpleMatch(attr, "( __visibility__ ( \"default\" ) )"))
-                    functok->isAttributeExport(true);
-            }
+        else if (Token::Match(attr, "[(,] packed [,)]") && Token::simpleMatch(tok->previous(), "}"))
+            tok->previous()->isAttributePacked(true);
 
-            Token::eraseTokens(tok, tok->linkAt(1)->next());
-            tok->deleteThis();
-        }
+        else if (functok && Token::simpleMatch(attr, "( __visibility__ ( \"default\" ) )"))
+            functok->isAttributeExport(true);
     }
+
+    return eraseAttribute(tok, tok->linkAt(1));
 }
 
-void Tokenizer::simplifyCppcheckAttribute()
+void Tokenizer::simplifyCppcheckAttribute(Token *tok)
 {
-    for (Token *tok = list.front(); tok; tok = tok->next()) {
-        if (tok->str() != "(")
-            continue;
-        if (!tok->previous())
-            continue;
-        const std::string &attr = tok->previous()->str();
-        if (attr.compare(0, 11, "__cppcheck_") != 0) // TODO: starts_with("__cppcheck_")
-            continue;
-        if (attr.compare(attr.size()-2, 2, "__") != 0) // TODO: ends_with("__")
-            continue;
-
-        Token *vartok = tok->link();
-        while (Token::Match(vartok->next(), "%name%|*|&|::")) {
-            vartok = vartok->next();
-            if (Token::Match(vartok, "%name% (") && vartok->str().compare(0,11,"__cppcheck_") == 0)
-                vartok = vartok->linkAt(1);
-        }
+    Token *vartok = tok->linkAt(1);
+    while (Token::Match(vartok->next(), "%name%|*|&|::")) {
+        vartok = vartok->next();
+        if (Token::Match(vartok, "%name% (") && vartok->str().compare(0,11,"__cppcheck_") == 0)
+            vartok = vartok->linkAt(1);
+    }
 
-        if (vartok->isName()) {
-            if (Token::Match(tok->previous(), "__cppcheck_low__ ( %num% )"))
-                vartok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(tok->next()->str()));
-            else if (Token::Match(tok->previous(), "__cppcheck_high__ ( %num% )"))
-                vartok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(tok->next()->str()));
-        }
+    if (vartok->isName()) {
+        if (Token::Match(tok, "__cppcheck_low__ ( %num% )"))
+            vartok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(tok->strAt(2)));
+        else if (Token::Match(tok, "__cppcheck_high__ ( %num% )"))
+            vartok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(tok->strAt(2)));
+    }
 
-        // Delete cppcheck attribute..
-        if (tok->tokAt(-2)) {
-            tok = tok->tokAt(-2);
-            Token::eraseTokens(tok, tok->linkAt(2)->next());
-        } else {
-            tok = tok->previous();
-            Token::eraseTokens(tok, tok->linkAt(1)->next());
-            tok->str(";");
-        }
+    // Delete cppcheck attribute..
+    if (tok->previous()) {
+        Token::eraseTokens(tok->previous(), tok->linkAt(1)->next());
+    } else {
+        Token::eraseTokens(tok, tok->linkAt(1)->next());
+        tok->str(";");
     }
 }
 
-void Tokenizer::simplifyCPPAttribute()
+/** Skip the C++11 attributes and \__attribute\__ that start at tok */
+static Token *skipAttributesAfter(Token *tok)
 {
-    if (mSettings->standards.cpp < Standards::CPP11 || isC())
-        return;
+    while (isCPPAttribute(tok) || isAlignAttribute(tok) || isAttribute(tok, true))
+        tok = (isAttribute(tok, true) ? tok->linkAt(1) : skipCPPOrAlignAttribute(tok))->next();
+    return tok;
+}
 
-    for (Token *tok = list.front(); tok;) {
-        if (!isCPPAttribute(tok) && !isAlignAttribute(tok)) {
-            tok = tok->next();
-            continue;
-        }
-        if (isCPPAttribute(tok)) {
-            if (Token::findsimplematch(tok->tokAt(2), "noreturn", tok->link())) {
-                Token * head = skipCPPOrAlignAttribute(tok)->next();
-                while (isCPPAttribute(head) || isAlignAttribute(head))
-                    head = skipCPPOrAlignAttribute(head)->next();
-                while (Token::Match(head, "%name%|::|*|&|<|>|,")) // skip return type
-                    head = head->next();
-                if (head && head->str() == "(" && isFunctionHead(head, "{|;")) {
-                    head->previous()->isAttributeNoreturn(true);
-                }
-            } else if (Token::findsimplematch(tok->tokAt(2), "nodiscard", tok->link())) {
-                Token * head = skipCPPOrAlignAttribute(tok)->next();
-                while (isCPPAttribute(head) || isAlignAttribute(head))
-                    head = skipCPPOrAlignAttribute(head)->next();
-                while (Token::Match(head, "%name%|::|*|&|<|>|,"))
-                    head = head->next();
-                if (head && head->str() == "(" && isFunctionHead(head, "{|;")) {
-                    head->previous()->isAttributeNodiscard(true);
-                }
-            } else if (Token::findsimplematch(tok->tokAt(2), "maybe_unused", tok->link())) {
-                Token* head = skipCPPOrAlignAttribute(tok)->next();
-                while (isCPPAttribute(head) || isAlignAttribute(head))
-                    head = skipCPPOrAlignAttribute(head)->next();
-                head->isAttributeMaybeUnused(true);
-            } else if (Token::Match(tok->previous(), ") [ [ expects|ensures|assert default|audit|axiom| : %name% <|<=|>|>= %num% ] ]")) {
-                const Token *vartok = tok->tokAt(4);
-                if (vartok->str() == ":")
-                    vartok = vartok->next();
-                Token *argtok = tok->tokAt(-2);
-                while (argtok && argtok->str() != "(") {
-                    if (argtok->str() == vartok->str())
-                        break;
-                    if (argtok->str() == ")")
-                        argtok = argtok->link();
-                    argtok = argtok->previous();
-                }
-                if (argtok && argtok->str() == vartok->str()) {
-                    if (vartok->next()->str() == ">=")
-                        argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(vartok->strAt(2)));
-                    else if (vartok->next()->str() == ">")
-                        argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(vartok->strAt(2))+1);
-                    else if (vartok->next()->str() == "<=")
-                        argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(vartok->strAt(2)));
-                    else if (vartok->next()->str() == "<")
-                        argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(vartok->strAt(2))-1);
-                }
+Token *Tokenizer::simplifyCPPAttribute(Token *tok)
+{
+    if (isCPPAttribute(tok)) {
+        if (Token::findsimplematch(tok->tokAt(2), "noreturn", tok->link())) {
+            Token * head = skipCPPOrAlignAttribute(tok)->next();
+            head = skipAttributesAfter(head);
+            while (Token::Match(head, "%name%|::|*|&|<|>|,")) // skip return type
+                head = head->next();
+            if (head && head->str() == "(" && isFunctionHead(head, "{|;")) {
+                head->previous()->isAttributeNoreturn(true);
+            }
+        } else if (Token::findsimplematch(tok->tokAt(2), "nodiscard", tok->link())) {
+            Token * head = skipCPPOrAlignAttribute(tok)->next();
+            head = skipAttributesAfter(head);
+            while (Token::Match(head, "%name%|::|*|&|<|>|,"))
+                head = head->next();
+            if (head && head->str() == "(" && isFunctionHead(head, "{|;")) {
+                head->previous()->isAttributeNodiscard(true);
+            }
+        } else if (Token::findsimplematch(tok->tokAt(2), "maybe_unused", tok->link())) {
+            Token* head = skipCPPOrAlignAttribute(tok)->next();
+            head = skipAttributesAfter(head);
+            head->isAttributeMaybeUnused(true);
+        } else if (Token::Match(tok->previous(), ") [ [ expects|ensures|assert default|audit|axiom| : %name% <|<=|>|>= %num% ] ]")) {
+            const Token *vartok = tok->tokAt(4);
+            if (vartok->str() == ":")
+                vartok = vartok->next();
+            Token *argtok = tok->tokAt(-2);
+            while (argtok && argtok->str() != "(") {
+                if (argtok->str() == vartok->str())
+                    break;
+                if (argtok->str() == ")")
+                    argtok = argtok->link();
+                argtok = argtok->previous();
             }
-        } else {
-            if (Token::simpleMatch(tok, "alignas (")) {
-                // alignment requirements could be checked here
+            if (argtok && argtok->str() == vartok->str()) {
+                if (vartok->next()->str() == ">=")
+                    argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(vartok->strAt(2)));
+                else if (vartok->next()->str() == ">")
+                    argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, MathLib::toLongNumber(vartok->strAt(2))+1);
+                else if (vartok->next()->str() == "<=")
+                    argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(vartok->strAt(2)));
+                else if (vartok->next()->str() == "<")
+                    argtok->setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::HIGH, MathLib::toLongNumber(vartok->strAt(2))-1);
             }
         }
-        Token::eraseTokens(tok, skipCPPOrAlignAttribute(tok)->next());
-        tok->deleteThis();
+    } else {
+        if (Token::simpleMatch(tok, "alignas (")) {
+            // alignment requirements could be checked here
+        }
     }
+    return eraseAttribute(tok, skipCPPOrAlignAttribute(tok));
 }
 
 void Tokenizer::simplifySpaceshipOperator()
@@ -9707,6 +9852,49 @@ void Tokenizer::createSymbolDatabase()
     mSymbolDatabase->validate();
 }
 
+const std::vector<const Token *> &Tokenizer::tokensWithStr(const std::string &str) const
+{
+    const auto scan = [this](const std::string &s, std::vector<const Token *> &tokens) {
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            if (tok->str() == s && !tok->isLiteral())
+                tokens.push_back(tok);
+        }
+    };
+
+    if (!list.isFinal()) {
+        // The token list can still change so nothing is kept
+        mTokenIndex.clear();
+        mNameIndexCreated = false;
+        std::vector<const Token *> &tokens = mTokenIndex[str];
+        scan(str, tokens);
+        return tokens;
+    }
+
+    if (!mNameIndexCreated) {
+        mTokenIndex.clear();
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            if (tok->isName() && !tok->isLiteral())
+                mTokenIndex[tok->str()].push_back(tok);
+        }
+        mNameIndexCreated = true;
+    }
+
+    const auto it = mTokenIndex.find(str);
+    if (it != mTokenIndex.end())
+        return it->second;
+
+    const bool isName = !str.empty() && (std::isalpha((unsigned char)str[0]) || str[0] == '_' || str[0] == '$');
+    if (isName) {
+        static const std::vector<const Token *> empty;
+        return empty;
+    }
+
+    // Other tokens are only indexed when they are asked for
+    std::vector<const Token *> &tokens = mTokenIndex[str];
+    scan(str, tokens);
+    return tokens;
+}
+
 bool Tokenizer::operatorEnd(const Token * tok) const
 {
     if (tok && tok->str() == ")") {
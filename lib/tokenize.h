@@ -30,6 +30,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class Settings;
@@ -463,17 +464,24 @@ private:
     void simplifyCallingConvention();
 
     /**
-     * Remove \__attribute\__ ((?))
+     * Remove C++11 attributes, then \__attribute\__ ((?)) and \__cppcheck\__ ((?))
+     * in a single walk over the token list
      */
-    void simplifyAttribute();
+    void removeAttributes();
+
+    /**
+     * Remove \__attribute\__ ((?)) at tok
+     * @return token after the removed attribute
+     */
+    Token *simplifyAttribute(Token *tok);
 
     /** Get function token for a attribute */
     Token* getAttributeFuncTok(Token* tok, bool gccattr) const;
 
     /**
-     * Remove \__cppcheck\__ ((?))
+     * Remove \__cppcheck\__ ((?)) at tok
      */
-    void simplifyCppcheckAttribute();
+    void simplifyCppcheckAttribute(Token *tok);
 
     /** Simplify c++20 spaceship operator */
     void simplifySpaceshipOperator();
@@ -543,9 +551,10 @@ private:
     void simplifyOverloadedOperators();
 
     /**
-     * Remove [[attribute]] (C++11 and later) from TokenList
+     * Remove [[attribute]] or alignas(..) (C++11 and later) at tok
+     * @return token after the removed attribute
      */
-    void simplifyCPPAttribute();
+    Token *simplifyCPPAttribute(Token *tok);
 
     /**
      * Convert namespace aliases
@@ -582,17 +591,17 @@ private:
     void setVarIdClassDeclaration(Token* const startToken, // cppcheck-suppress functionConst // has side effects
                                   VariableMap& variableMap,
                                   const nonneg int scopeStartVarId,
-                                  std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers);
+                                  std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers);
 
     void setVarIdStructMembers(Token **tok1,
-                               std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers,
+                               std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers,
                                nonneg int &varId) const;
 
     void setVarIdClassFunction(const std::string &classname, // cppcheck-suppress functionConst // has side effects
                                Token * const startToken,
                                const Token * const endToken,
-                               const std::map<std::string, nonneg int> &varlist,
-                               std::map<nonneg int, std::map<std::string, nonneg int>>& structMembers,
+                               const std::unordered_map<std::string, nonneg int> &varlist,
+                               std::unordered_map<nonneg int, std::unordered_map<std::string, nonneg int>>& structMembers,
                                nonneg int &varId_);
 
     /**
@@ -649,6 +658,17 @@ public:
         return list.front();
     }
 
+    /**
+     * Get all tokens with the given str, in token list order. Literals are not included.
+     * When the token list is final the names are indexed by the first call, so the checks
+     * share a single walk over the token list. Other tokens, such as "=", are indexed the
+     * first time they are asked for. Before the token list is final every call scans the
+     * token list and the returned vector is only valid until the next call.
+     * @param str the token str, for instance "sizeof" or "="
+     * @return the matching tokens
+     */
+    const std::vector<const Token *> &tokensWithStr(const std::string &str) const;
+
     /**
      * Helper function to check whether number is one (1 or 0.1E+1 or 1E+0) or not?
      * @param s the string to check
@@ -709,6 +729,10 @@ private:
     /** sizeof information for known types */
     std::map<std::string, int> mTypeSize;
 
+    /** tokens by str, created by tokensWithStr() */
+    mutable std::unordered_map<std::string, std::vector<const Token *>> mTokenIndex;
+    mutable bool mNameIndexCreated{};
+
     struct TypedefInfo {
         std::string name;
         std::string filename;
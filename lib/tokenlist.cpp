@@ -77,6 +77,7 @@ void TokenList::deallocateTokens()
     deleteTokens(mTokensFrontBack.front);
     mTokensFrontBack.front = nullptr;
     mTokensFrontBack.back = nullptr;
+    mFinal = false;
     mFiles.clear();
 }
 
@@ -192,6 +192,19 @@ public:
 
     bool isKeyword(const std::string &str) const;
 
+    /**
+     * Mark that the token list, the AST and the symbol database information in
+     * the tokens will not change anymore. Lookups that depend on them can then
+     * be cached in the tokens.
+     */
+    void setFinal() {
+        mFinal = true;
+    }
+
+    bool isFinal() const {
+        return mFinal;
+    }
+
 private:
     void determineCppC();
 
@@ -210,6 +223,9 @@ private:
     /** File is known to be C/C++ code */
     bool mIsC{};
     bool mIsCpp{};
+
+    /** see setFinal() */
+    bool mFinal{};
 };
 
 /// @}
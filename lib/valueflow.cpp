@@ -1132,9 +1132,9 @@ static bool getMinMaxValues(const ValueType* vt, const cppcheck::Platform& platf
 // Handle various constants..
 static Token * valueFlowSetConstantValue(Token *tok, const Settings *settings, bool cpp, bool isInitList = false)
 {
-    if ((tok->isNumber() && MathLib::isInt(tok->str())) || (tok->tokType() == Token::eChar)) {
+    if (tok->isIntNumber() || (tok->tokType() == Token::eChar)) {
         try {
-            MathLib::bigint signedValue = MathLib::toLongNumber(tok->str());
+            MathLib::bigint signedValue = tok->toLongNumber();
             const ValueType* vt = tok->valueType();
             if (vt && vt->sign == ValueType::UNSIGNED && signedValue < 0 && ValueFlow::getSizeOf(*vt, settings) < sizeof(MathLib::bigint)) {
                 MathLib::bigint minValue{}, maxValue{};
@@ -1148,10 +1148,10 @@ static Token * valueFlowSetConstantValue(Token *tok, const Settings *settings, b
         } catch (const std::exception & /*e*/) {
             // Bad character literal
         }
-    } else if (tok->isNumber() && MathLib::isFloat(tok->str())) {
+    } else if (tok->isFloatNumber()) {
         ValueFlow::Value value;
         value.valueType = ValueFlow::Value::ValueType::FLOAT;
-        value.floatValue = MathLib::toDoubleNumber(tok->str());
+        value.floatValue = tok->toDoubleNumber();
         if (!tok->isTemplateArg())
             value.setKnown();
         setTokenValue(tok, std::move(value), settings, isInitList);
@@ -1303,7 +1303,7 @@ static Token * valueFlowSetConstantValue(Token *tok, const Settings *settings, b
             const Token* brac = tok2->astParent();
             while (Token::simpleMatch(brac, "[")) {
                 const Token* num = brac->astOperand2();
-                if (num && ((num->isNumber() && MathLib::isInt(num->str())) || num->tokType() == Token::eChar)) {
+                if (num && (num->isIntNumber() || num->tokType() == Token::eChar)) {
                     try {
                         const MathLib::biguint dim = MathLib::toULongNumber(num->str());
                         sz *= dim;
@@ -1622,10 +1622,10 @@ static void valueFlowBitAnd(TokenList &tokenlist, const Settings* settings)
             continue;
 
         MathLib::bigint number;
-        if (MathLib::isInt(tok->astOperand1()->str()))
-            number = MathLib::toLongNumber(tok->astOperand1()->str());
-        else if (MathLib::isInt(tok->astOperand2()->str()))
-            number = MathLib::toLongNumber(tok->astOperand2()->str());
+        if (tok->astOperand1()->isIntNumber())
+            number = tok->astOperand1()->toLongNumber();
+        else if (tok->astOperand2()->isIntNumber())
+            number = tok->astOperand2()->toLongNumber();
         else
             continue;
 
@@ -2880,6 +2880,28 @@ struct ValueFlowAnalyzer : Analyzer {
         return Action::None;
     }
 
+    bool isIndependent(const Token* tok) const override {
+        if (invalid())
+            return false;
+        if (dependsOnThis())
+            return false;
+        // Lifetime and symbolic values can make the token an alias of the expression
+        if (std::any_of(tok->values().cbegin(), tok->values().cend(), [](const ValueFlow::Value& v) {
+            return !v.isIntValue() && !v.isFloatValue();
+        }))
+            return false;
+        const Variable* var = tok->variable();
+        if (var && (var->isReference() || var->isRValueReference()))
+            return false;
+        if (Token::Match(tok, "%name% (") &&
+            (isGlobal() || (tok->function() && Function::returnsReference(tok->function()))))
+            return false;
+        if (match(tok) || internalMatch(tok))
+            return false;
+        bool inconclusive = false;
+        return !isAlias(tok, inconclusive);
+    }
+
     template<class F>
     std::vector<MathLib::bigint> evaluateInt(const Token* tok, F getProgramMemory) const
     {
@@ -6919,6 +6941,24 @@ struct SymbolicConditionHandler : SimpleConditionHandler {
     }
 };
 
+static bool getSlotValues(const ProgramMemory& pm, const std::vector<nonneg int>& exprIds, CompiledExpression::Slots& slots)
+{
+    slots.clear();
+    for (const nonneg int exprid : exprIds) {
+        const ValueFlow::Value* value = pm.getValue(exprid);
+        if (!value || !value->isIntValue())
+            return false;
+        slots.push_back(value->intvalue);
+    }
+    return true;
+}
+
+static void setSlotValues(ProgramMemory& pm, const std::vector<nonneg int>& exprIds, const CompiledExpression::Slots& slots)
+{
+    for (std::size_t i = 0; i < exprIds.size(); ++i)
+        pm.at(exprIds[i]).intvalue = slots[i];
+}
+
 static bool valueFlowForLoop2(const Token *tok,
                               ProgramMemory *memory1,
                               ProgramMemory *memory2,
@@ -6956,11 +6996,31 @@ static bool valueFlowForLoop2(const Token *tok,
     ProgramMemory endMemory;
 
     int maxcount = 10000;
-    while (result != 0 && !error && --maxcount > 0) {
-        endMemory = programMemory;
-        execute(thirdExpression, programMemory, &result, &error);
-        if (!error)
-            execute(secondExpression, programMemory, &result, &error);
+    std::vector<nonneg int> exprIds;
+    const CompiledExpression step(thirdExpression, exprIds);
+    const CompiledExpression cond(secondExpression, exprIds);
+    CompiledExpression::Slots slots;
+    if (step.valid() && cond.valid() && getSlotValues(programMemory, exprIds, slots)) {
+        // Simulate the loop without interpreting the tokens in every iteration
+        CompiledExpression::Slots endSlots;
+        bool looped = false;
+        while (result != 0 && !error && --maxcount > 0) {
+            endSlots = slots;
+            looped = true;
+            error = !step.execute(slots, result) || !cond.execute(slots, result);
+        }
+        if (looped) {
+            endMemory = programMemory;
+            setSlotValues(endMemory, exprIds, endSlots);
+        }
+        setSlotValues(programMemory, exprIds, slots);
+    } else {
+        while (result != 0 && !error && --maxcount > 0) {
+            endMemory = programMemory;
+            execute(thirdExpression, programMemory, &result, &error);
+            if (!error)
+                execute(secondExpression, programMemory, &result, &error);
+        }
     }
 
     if (memory1)
@@ -7125,24 +7185,25 @@ static void valueFlowForLoop(TokenList &tokenlist, const SymbolDatabase& symbold
         MathLib::bigint initValue, stepValue, lastValue;
 
         if (extractForLoopValues(tok, varid, knownInitValue, initValue, partialCond, stepValue, lastValue)) {
-            const bool executeBody = !knownInitValue || initValue <= lastValue;
+            // The loop variable moves from initValue towards lastValue
+            const bool countDown = stepValue < 0;
+            const bool executeBody = !knownInitValue || (countDown ? initValue >= lastValue : initValue <= lastValue);
             const Token* vartok = Token::findmatch(tok, "%varid%", bodyStart, varid);
             if (executeBody && vartok) {
                 std::list<ValueFlow::Value> initValues;
-                initValues.emplace_back(initValue, ValueFlow::Value::Bound::Lower);
+                initValues.emplace_back(initValue, countDown ? ValueFlow::Value::Bound::Upper : ValueFlow::Value::Bound::Lower);
                 initValues.push_back(ValueFlow::asImpossible(initValues.back()));
                 Analyzer::Result result = valueFlowForward(bodyStart, bodyStart->link(), vartok, initValues, tokenlist, settings);
 
                 if (!result.action.isModified()) {
                     std::list<ValueFlow::Value> lastValues;
-                    lastValues.emplace_back(lastValue, ValueFlow::Value::Bound::Upper);
+                    lastValues.emplace_back(lastValue, countDown ? ValueFlow::Value::Bound::Lower : ValueFlow::Value::Bound::Upper);
                     lastValues.back().conditional = true;
                     lastValues.push_back(ValueFlow::asImpossible(lastValues.back()));
-                    if (stepValue != 1)
-                        lastValues.pop_front();
                     valueFlowForward(bodyStart, bodyStart->link(), vartok, lastValues, tokenlist, settings);
                 }
             }
+            // extractForLoopValues() checked that lastValue + stepValue does not overflow
             const MathLib::bigint afterValue = executeBody ? lastValue + stepValue : initValue;
             valueFlowForLoopSimplifyAfter(tok, varid, afterValue, tokenlist, settings);
         } else {
@@ -7380,13 +7441,41 @@ bool productParams(const Settings* settings, const std::unordered_map<Key, std::
     return !bail;
 }
 
+using SubFunctionArgs = std::unordered_map<const Variable*, ValueFlow::Value>;
+
+// The error path, path id, condition and source variable only describe the call site
+static bool isSameSubFunctionValue(const ValueFlow::Value& x, const ValueFlow::Value& y)
+{
+    return x.equalValue(y) && x.valueKind == y.valueKind && x.bound == y.bound && x.tokvalue == y.tokvalue &&
+           x.conditional == y.conditional && x.defaultArg == y.defaultArg && x.indirect == y.indirect &&
+           x.safe == y.safe && x.moveKind == y.moveKind && x.lifetimeKind == y.lifetimeKind &&
+           x.lifetimeScope == y.lifetimeScope && x.capturetok == y.capturetok;
+}
+
+static bool isSameSubFunctionArgs(const SubFunctionArgs& x, const SubFunctionArgs& y)
+{
+    if (x.size() != y.size())
+        return false;
+    return std::all_of(x.cbegin(), x.cend(), [&](const SubFunctionArgs::value_type& p) {
+        auto it = y.find(p.first);
+        return it != y.end() && isSameSubFunctionValue(p.second, it->second);
+    });
+}
+
 static void valueFlowInjectParameter(TokenList& tokenlist,
                                      ErrorLogger* errorLogger,
                                      const Settings& settings,
                                      const Scope* functionScope,
-                                     const std::unordered_map<const Variable*, std::list<ValueFlow::Value>>& vars)
+                                     const std::unordered_map<const Variable*, std::list<ValueFlow::Value>>& vars,
+                                     std::vector<SubFunctionArgs>& injected)
 {
-    const bool r = productParams(&settings, vars, [&](const std::unordered_map<const Variable*, ValueFlow::Value>& arg) {
+    const bool r = productParams(&settings, vars, [&](const SubFunctionArgs& arg) {
+        // The same argument values from another call site would only add duplicate values
+        if (std::any_of(injected.cbegin(), injected.cend(), [&](const SubFunctionArgs& args) {
+            return isSameSubFunctionArgs(args, arg);
+        }))
+            return;
+        injected.push_back(arg);
         MultiValueFlowAnalyzer a(arg, tokenlist, &settings);
         valueFlowGenericForward(const_cast<Token*>(functionScope->bodyStart), functionScope->bodyEnd, a, settings);
     });
@@ -7448,7 +7537,7 @@ static void valueFlowSwitchVariable(TokenList &tokenlist, const SymbolDatabase&
             }
             if (Token::Match(tok, "case %num% :")) {
                 std::list<ValueFlow::Value> values;
-                values.emplace_back(MathLib::toLongNumber(tok->next()->str()));
+                values.emplace_back(tok->next()->toLongNumber());
                 values.back().condition = tok;
                 values.back().errorPath.emplace_back(tok, "case " + tok->next()->str() + ": " + vartok->str() + " is " + tok->next()->str() + " here.");
                 bool known = false;
@@ -7459,7 +7548,7 @@ static void valueFlowSwitchVariable(TokenList &tokenlist, const SymbolDatabase&
                     tok = tok->tokAt(3);
                     if (!tok->isName())
                         tok = tok->next();
-                    values.emplace_back(MathLib::toLongNumber(tok->next()->str()));
+                    values.emplace_back(tok->next()->toLongNumber());
                     values.back().condition = tok;
                     values.back().errorPath.emplace_back(tok, "case " + tok->next()->str() + ": " + vartok->str() + " is " + tok->next()->str() + " here.");
                 }
@@ -7561,6 +7650,8 @@ IteratorRange<Iterator> MakeIteratorRange(Iterator start, Iterator last)
 static void valueFlowSubFunction(TokenList& tokenlist, SymbolDatabase& symboldatabase,  ErrorLogger* errorLogger, const Settings& settings)
 {
     int id = 0;
+    // Argument values that have been passed into each function
+    std::unordered_map<const Scope*, std::vector<SubFunctionArgs>> injected;
     for (const Scope* scope : MakeIteratorRange(symboldatabase.functionScopes.crbegin(), symboldatabase.functionScopes.crend())) {
         const Function* function = scope->function;
         if (!function)
@@ -7635,7 +7726,7 @@ static void valueFlowSubFunction(TokenList& tokenlist, SymbolDatabase& symboldat
 
                 argvars[argvar] = argvalues;
             }
-            valueFlowInjectParameter(tokenlist, errorLogger, settings, calledFunctionScope, argvars);
+            valueFlowInjectParameter(tokenlist, errorLogger, settings, calledFunctionScope, argvars, injected[calledFunctionScope]);
         }
     }
 }
@@ -9298,9 +9389,10 @@ struct ValueFlowPassRunner {
     using Clock = std::chrono::steady_clock;
     using TimePoint = std::chrono::time_point<Clock>;
     explicit ValueFlowPassRunner(ValueFlowState state, TimerResultsIntf* timerResults = nullptr)
-        : state(std::move(state)), stop(TimePoint::max()), timerResults(timerResults)
+        : state(std::move(state)), start(Clock::now()), stop(TimePoint::max()), timerResults(timerResults)
     {
         setSkippedFunctions();
+        setForwardBudgets();
         setStopTime();
     }
 
@@ -9322,6 +9414,11 @@ struct ValueFlowPassRunner {
             }))
                 return true;
             --n;
+            // Don't iterate further when more than half of the time is used
+            if (isLowOnTime()) {
+                reportTimeLimit("ValueFlow iterations skipped, more than half of the time limit is used");
+                break;
+            }
         }
         if (state.settings->debugwarnings) {
             if (n == 0 && values != getTotalValues()) {
@@ -9341,9 +9438,10 @@ struct ValueFlowPassRunner {
 
     bool run(const ValuePtr<ValueFlowPass>& pass) const
     {
-        auto start = Clock::now();
-        if (start > stop)
+        if (Clock::now() > stop) {
+            reportTimeLimit("ValueFlow passes skipped, the time limit is exceeded");
             return true;
+        }
         if (!state.tokenlist.isCPP() && pass->cpp())
             return false;
         if (timerResults) {
@@ -9400,14 +9498,64 @@ struct ValueFlowPassRunner {
         }
     }
 
+    // All forward analysis in a function shares one budget, which grows with
+    // the size of the function. Small functions are counted as 100 tokens, as
+    // they are analysed again from each call site.
+    void setForwardBudgets() const
+    {
+        const int percent = state.settings->performanceValueFlowForwardBudget;
+        for (const Scope* functionScope : state.symboldatabase.functionScopes) {
+            functionScope->hasForwardBudget = percent > 0 && functionScope->bodyStart && functionScope->bodyEnd;
+            functionScope->forwardBudgetExceeded = false;
+            if (!functionScope->hasForwardBudget)
+                continue;
+            const std::size_t size = functionScope->bodyEnd->index() - functionScope->bodyStart->index();
+            functionScope->forwardBudget = std::max<std::size_t>(size, 100) * percent / 100;
+        }
+    }
+
+    void reportForwardBudgets() const
+    {
+        if (!state.settings->debugwarnings)
+            return;
+        for (const Scope* functionScope : state.symboldatabase.functionScopes) {
+            if (functionScope->forwardBudgetExceeded)
+                bailout(state.tokenlist, state.errorLogger, functionScope->bodyStart,
+                        "forward analysis budget exceeded in " + functionScope->className);
+        }
+    }
+
     void setStopTime()
     {
         if (state.settings->performanceValueFlowMaxTime >= 0)
-            stop = Clock::now() + std::chrono::seconds{state.settings->performanceValueFlowMaxTime};
+            stop = start + std::chrono::seconds{state.settings->performanceValueFlowMaxTime};
+    }
+
+    bool isLowOnTime() const
+    {
+        return stop != TimePoint::max() && Clock::now() > start + (stop - start) / 2;
+    }
+
+    void reportTimeLimit(const std::string& msg) const
+    {
+        if (!state.settings->debugwarnings || timeLimitReported)
+            return;
+        timeLimitReported = true;
+        ErrorMessage::FileLocation loc;
+        loc.setfile(state.tokenlist.getFiles()[0]);
+        ErrorMessage errmsg({std::move(loc)},
+                            emptyString,
+                            Severity::debug,
+                            msg,
+                            "valueFlowMaxTime",
+                            Certainty::normal);
+        state.errorLogger->reportErr(errmsg);
     }
 
     ValueFlowState state;
+    TimePoint start;
     TimePoint stop;
+    mutable bool timeLimitReported{};
     TimerResultsIntf* timerResults;
 };
 
@@ -9517,6 +9665,8 @@ void ValueFlow::setValues(TokenList& tokenlist,
         VFA(valueFlowDynamicBufferSize(tokenlist, symboldatabase, settings)),
         VFA(valueFlowDebug(tokenlist, errorLogger, settings)),
     });
+
+    runner.reportForwardBudgets();
 }
 
 std::string ValueFlow::eitherTheConditionIsRedundant(const Token *condition)
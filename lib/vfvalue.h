@@ -22,6 +22,7 @@
 //---------------------------------------------------------------------------
 
 #include "config.h"
+#include "errortypes.h"
 #include "mathlib.h"
 
 #include <cassert>
@@ -39,8 +40,8 @@ namespace ValueFlow
 {
     class CPPCHECKLIB Value {
     public:
-        using ErrorPathItem = std::pair<const Token *, std::string>;
-        using ErrorPath = std::list<ErrorPathItem>;
+        using ErrorPathItem = ::ErrorPathItem;
+        using ErrorPath = ::ErrorPath;
         enum class Bound { Upper, Lower, Point };
 
         explicit Value(long long val = 0, Bound b = Bound::Point) :
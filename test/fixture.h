@@ -29,6 +29,7 @@
 #include "platform.h"
 #include "settings.h"
 #include "standards.h"
+#include "tokenize.h"
 
 #include <cstddef>
 #include <list>
@@ -38,7 +39,6 @@
 #include <utility>
 
 class options;
-class Tokenizer;
 
 class TestFixture : public ErrorLogger {
 private:
@@ -128,7 +128,18 @@ protected:
     static void runChecks(const Tokenizer *tokenizer, const Settings *settings, ErrorLogger *errorLogger)
     {
         T& check = getCheck<T>();
-        check.runChecks(tokenizer, settings, errorLogger);
+        if (check.canRunChecks(tokenizer, settings))
+            check.runChecks(tokenizer, settings, errorLogger);
+    }
+
+    /** Tokenize the code and ask check T if it has anything to check */
+    template<typename T>
+    bool canRun(const char code[], const Settings &settings, const char filename[] = "test.cpp")
+    {
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        assert_(__FILE__, __LINE__, tokenizer.tokenize(istr, filename));
+        return T(&tokenizer, &settings, this).canRunChecks(&tokenizer, &settings);
     }
 
     class SettingsBuilder
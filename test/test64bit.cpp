@@ -40,6 +40,7 @@ private:
         TEST_CASE(ptrarithmetic);
         TEST_CASE(returnIssues);
         TEST_CASE(assignment);
+        TEST_CASE(canRunChecks);
     }
 
 #define check(code) check_(code, __FILE__, __LINE__)
@@ -293,6 +294,11 @@ private:
               "}");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<Check64BitPortability>("void f(int *p) { int x = p; }", settings));
+        ASSERT(!canRun<Check64BitPortability>("void f(int *p) { int x = p; }", settingsBuilder().build()));
+    }
 };
 
 REGISTER_TEST(Test64BitPortability)
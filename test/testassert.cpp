@@ -53,6 +53,7 @@ private:
         TEST_CASE(memberFunctionCallInAssert);
         TEST_CASE(safeFunctionCallInAssert);
         TEST_CASE(crash);
+        TEST_CASE(canRunChecks);
     }
 
 
@@ -252,6 +253,12 @@ private:
               "}");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckAssert>("void f(int x) { assert(x); }", settings));
+        ASSERT(!canRun<CheckAssert>("void f(int x) { if (x) {} }", settings));
+        ASSERT(!canRun<CheckAssert>("void f(int x) { assert(x); }", settingsBuilder().build()));
+    }
 };
 
 REGISTER_TEST(TestAssert)
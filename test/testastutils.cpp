@@ -28,6 +28,7 @@
 
 #include <cstring>
 #include <sstream> // IWYU pragma: keep
+#include <unordered_map>
 
 class TestAstUtils : public TestFixture {
 public:
@@ -41,6 +42,7 @@ private:
         TEST_CASE(isNullOperandTest);
         TEST_CASE(isReturnScopeTest);
         TEST_CASE(isSameExpressionTest);
+        TEST_CASE(getExpressionHashTest);
         TEST_CASE(isVariableChangedTest);
         TEST_CASE(isVariableChangedByFunctionCallTest);
         TEST_CASE(isExpressionChangedTest);
@@ -213,6 +215,29 @@ private:
         ASSERT_EQUALS(true, true);
     }
 
+#define isSameExpressionHash(code, tokStr1, tokStr2) isSameExpressionHash_(code, tokStr1, tokStr2, __FILE__, __LINE__)
+    bool isSameExpressionHash_(const char code[], const char tokStr1[], const char tokStr2[], const char* file, int line) {
+        const Settings settings;
+        Tokenizer tokenizer(&settings, this);
+        std::istringstream istr(code);
+        ASSERT_LOC(tokenizer.tokenize(istr, "test.cpp"), file, line);
+        const Token * const tok1 = Token::findsimplematch(tokenizer.tokens(), tokStr1, strlen(tokStr1));
+        const Token * const tok2 = Token::findsimplematch(tok1->next(), tokStr2, strlen(tokStr2));
+        std::unordered_map<const Token*, std::size_t> cache;
+        return getExpressionHash(true, tok1, cache) == getExpressionHash(true, tok2, cache);
+    }
+
+    void getExpressionHashTest() {
+        ASSERT_EQUALS(true, isSameExpressionHash("void f(int x) { x + 1; x + 1; }", "+", "+"));
+        ASSERT_EQUALS(true, isSameExpressionHash("void f(int x) { 1 + x; x + 1; }", "+", "+"));
+        ASSERT_EQUALS(false, isSameExpressionHash("void f(int x) { x + 1; x + 2; }", "+", "+"));
+        ASSERT_EQUALS(false, isSameExpressionHash("void f(int x) { x - 1; 1 - x; }", "-", "-"));
+        ASSERT_EQUALS(true, isSameExpressionHash("void f(int a, int b) { a > b; b < a; }", ">", "<"));
+        ASSERT_EQUALS(true, isSameExpressionHash("void f(bool a, bool b) { !!a == b; a == b; }", "==", "=="));
+        ASSERT_EQUALS(true, isSameExpressionHash("void f(int x) { int& r = x; r * 2; x * 2; }", "*", "*"));
+        ASSERT_EQUALS(true, isSameExpressionHash("struct S { int x; void f() { this->x + 1; x + 1; } };", "+", "+"));
+    }
+
 #define isVariableChanged(code, startPattern, endPattern) isVariableChanged_(code, startPattern, endPattern, __FILE__, __LINE__)
     bool isVariableChanged_(const char code[], const char startPattern[], const char endPattern[], const char* file, int line) {
         const Settings settings;
@@ -34,6 +34,7 @@ private:
 
     void run() override {
         TEST_CASE(BoostForeachContainerModification);
+        TEST_CASE(canRunChecks);
     }
 
 #define check(code) check_(code, __FILE__, __LINE__)
@@ -100,6 +101,12 @@ private:
               "}");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckBoost>("void f() { BOOST_FOREACH(int i, data) {} }", settings));
+        ASSERT(!canRun<CheckBoost>("void f() { for (int i : data) {} }", settings));
+        ASSERT(!canRun<CheckBoost>("void f() { BOOST_FOREACH(int i, data) {} }", settings, "test.c"));
+    }
 };
 
 REGISTER_TEST(TestBoost)
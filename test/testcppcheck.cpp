@@ -45,6 +45,7 @@ private:
 
     void run() override {
         TEST_CASE(getErrorMessages);
+        TEST_CASE(getRequiredLiteral);
     }
 
     void getErrorMessages() const {
@@ -76,6 +77,40 @@ private:
         ASSERT(foundPurgedConfiguration);
         ASSERT(foundTooManyConfigs);
     }
+
+    void getRequiredLiteral() const {
+        ASSERT_EQUALS("abc", CppCheck::getRequiredLiteral("abc"));
+        ASSERT_EQUALS("memset ( %name% , 0", CppCheck::getRequiredLiteral("memset \\( %name% , 0"));
+
+        // character classes
+        ASSERT_EQUALS("x", CppCheck::getRequiredLiteral("[[:alpha:]]x"));
+        ASSERT_EQUALS("x", CppCheck::getRequiredLiteral("[^[:digit:][:space:]]x"));
+        ASSERT_EQUALS("yz", CppCheck::getRequiredLiteral("[[=a=][.b.]]yz"));
+        ASSERT_EQUALS("bc", CppCheck::getRequiredLiteral("[]a]bc"));
+        ASSERT_EQUALS("bc", CppCheck::getRequiredLiteral("[^]a]bc"));
+        ASSERT_EQUALS("bc", CppCheck::getRequiredLiteral("[a\\]]bc"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("[[:alpha:]x"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("[\\Q]\\E]"));
+
+        // escapes
+        ASSERT_EQUALS("a.b", CppCheck::getRequiredLiteral("a\\.b"));
+        ASSERT_EQUALS("abc", CppCheck::getRequiredLiteral("ab\\d+abc"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("\\x41"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("\\Qab\\E"));
+
+        // alternation
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("abc|def"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("x(abc|def)"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("(?i)abc"));
+        ASSERT_EQUALS("cd", CppCheck::getRequiredLiteral("(?:ab)?cd"));
+
+        // quantifiers
+        ASSERT_EQUALS("a", CppCheck::getRequiredLiteral("ab*"));
+        ASSERT_EQUALS("a", CppCheck::getRequiredLiteral("ab?"));
+        ASSERT_EQUALS("ab", CppCheck::getRequiredLiteral("ab+"));
+        ASSERT_EQUALS("abc", CppCheck::getRequiredLiteral("ab{2}abc"));
+        ASSERT_EQUALS("", CppCheck::getRequiredLiteral("ab{2"));
+    }
 };
 
 REGISTER_TEST(TestCppcheck)
@@ -64,6 +64,8 @@ private:
         TEST_CASE(suppressUnmatchedSuppressions);
         TEST_CASE(substituteTemplateFormatStatic);
         TEST_CASE(substituteTemplateLocationStatic);
+
+        TEST_CASE(errorPathCopyOnWrite);
     }
 
     void TestPatternSearchReplace(const std::string& idPlaceholder, const std::string& id) const {
@@ -545,6 +547,31 @@ private:
             ASSERT_EQUALS("{", s);
         }
     }
+
+    void errorPathCopyOnWrite() const {
+        ErrorPath path1;
+        ASSERT(path1.empty());
+        path1.emplace_back(nullptr, "a");
+        ErrorPath path2 = path1;
+        path2.emplace_back(nullptr, "b");
+        path2.insert(path2.cbegin(), ErrorPathItem(nullptr, "c"));
+        ASSERT_EQUALS(1U, path1.size());
+        ASSERT_EQUALS("a", path1.back().second);
+        ASSERT_EQUALS(3U, path2.size());
+        ASSERT_EQUALS("c", path2.front().second);
+        ASSERT_EQUALS("b", path2.back().second);
+
+        ErrorPath path3 = path2;
+        ASSERT(path3 == path2);
+        path3.remove_if([](const ErrorPathItem& e) {
+            return e.second == "a";
+        });
+        ASSERT_EQUALS(2U, path3.size());
+        ASSERT_EQUALS(3U, path2.size());
+        ASSERT(path3 != path2);
+        path3.clear();
+        ASSERT(path3.empty());
+    }
 };
 
 REGISTER_TEST(TestErrorLogger)
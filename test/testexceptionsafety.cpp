@@ -56,6 +56,7 @@ private:
         TEST_CASE(rethrowNoCurrentException1);
         TEST_CASE(rethrowNoCurrentException2);
         TEST_CASE(rethrowNoCurrentException3);
+        TEST_CASE(canRunChecks);
     }
 
 #define check(...) check_(__FILE__, __LINE__, __VA_ARGS__)
@@ -453,6 +454,14 @@ private:
               "void func3() { throw 0; }");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckExceptionSafety>("void f() { throw 1; }", settings));
+        ASSERT(canRun<CheckExceptionSafety>("void f() { try { g(); } catch (...) {} }", settings));
+        ASSERT(canRun<CheckExceptionSafety>("void f() noexcept { g(); }", settings));
+        ASSERT(!canRun<CheckExceptionSafety>("void f() { g(); }", settings));
+        ASSERT(!canRun<CheckExceptionSafety>("void f() { g(); }", settings, "test.c"));
+    }
 };
 
 REGISTER_TEST(TestExceptionSafety)
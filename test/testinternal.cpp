@@ -46,6 +46,7 @@ private:
         TEST_CASE(orInComplexPattern);
         TEST_CASE(extraWhitespace);
         TEST_CASE(checkRedundantTokCheck);
+        TEST_CASE(canRunChecks);
     }
 
 #define check(code) check_(code, __FILE__, __LINE__)
@@ -526,6 +527,11 @@ private:
               "}");
         ASSERT_EQUALS("[test.cpp:3]: (style) Unnecessary check of \"tok->previous()->previous()\", match-function already checks if it is null.\n", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckInternal>("void f() {}", settings));
+        ASSERT(!canRun<CheckInternal>("void f() {}", settingsBuilder().build()));
+    }
 };
 
 REGISTER_TEST(TestInternal)
@@ -79,6 +79,7 @@ private:
         TEST_CASE(testPrintfParenthesis); // #8489
         TEST_CASE(testStdDistance); // #10304
         TEST_CASE(testParameterPack); // #11289
+        TEST_CASE(canRunChecks);
     }
 
 #define check(...) check_(__FILE__, __LINE__, __VA_ARGS__)
@@ -4912,6 +4913,16 @@ private:
               "}\n");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckIO>("void f() { std::cout << 1; }", settings));
+        ASSERT(canRun<CheckIO>("void f(FILE *f) {}", settings));
+        ASSERT(canRun<CheckIO>("void f(char *s) { scanf(\"%s\", s); }", settings));
+        ASSERT(canRun<CheckIO>("void f() { printf(\"%d\", 1); }", settings));
+        ASSERT(canRun<CheckIO>("void f(QString s) { s = QString::asprintf(\"%d\", 1); }", settings));
+        ASSERT(!canRun<CheckIO>("int f(int x) { return x + 1; }", settings));
+        ASSERT(!canRun<CheckIO>("void f() { printf(\"%d\", 1); }", settingsBuilder().build()));
+    }
 };
 
 REGISTER_TEST(TestIO)
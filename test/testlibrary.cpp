@@ -27,6 +27,7 @@
 #include "tokenlist.h"
 
 #include <cstddef>
+#include <fstream>
 #include <map>
 #include <sstream> // IWYU pragma: keep
 #include <string>
@@ -60,6 +61,7 @@ private:
         TEST_CASE(function_arg_minsize);
         TEST_CASE(function_namespace);
         TEST_CASE(function_method);
+        TEST_CASE(function_cached);
         TEST_CASE(function_baseClassMethod); // calling method in base class
         TEST_CASE(function_warn);
         TEST_CASE(memory);
@@ -70,6 +72,7 @@ private:
         TEST_CASE(container);
         TEST_CASE(version);
         TEST_CASE(loadLibErrors);
+        TEST_CASE(loadLibDuplicate);
     }
 
     static bool loadxmldata(Library &lib, const char xmldata[], std::size_t len)
@@ -594,6 +597,48 @@ private:
         }
     }
 
+    void function_cached() const {
+        const char xmldata1[] = "<?xml version=\"1.0\"?>\n"
+                                "<def>\n"
+                                "  <function name=\"foo\">\n"
+                                "    <arg nr=\"1\"/>\n"
+                                "  </function>\n"
+                                "</def>";
+        const char xmldata2[] = "<?xml version=\"1.0\"?>\n"
+                                "<def>\n"
+                                "  <function name=\"foo\">\n"
+                                "    <arg nr=\"1\"/>\n"
+                                "    <arg nr=\"2\"/>\n"
+                                "  </function>\n"
+                                "</def>";
+
+        Library library1;
+        ASSERT(loadxmldata(library1, xmldata1, sizeof(xmldata1)));
+        Library library2;
+        ASSERT(loadxmldata(library2, xmldata2, sizeof(xmldata2)));
+
+        {
+            TokenList tokenList(nullptr);
+            std::istringstream istr("foo(123);");
+            tokenList.createTokens(istr);
+            ASSERT(!tokenList.isFinal());
+            ASSERT(!tokenList.front()->libraryFunction(&library1)); // not cached before the token list is final
+        }
+
+        Tokenizer tokenizer(&settings, nullptr);
+        std::istringstream istr("void f() { foo(123); }");
+        ASSERT(tokenizer.tokenize(istr, "test.cpp"));
+        ASSERT(tokenizer.list.isFinal());
+        const Token *ftok = Token::findsimplematch(tokenizer.tokens(), "foo");
+
+        // the cached result belongs to the library that computed it
+        ASSERT_EQUALS("foo", library1.getFunctionName(ftok));
+        ASSERT(!library1.isNotLibraryFunction(ftok));
+        ASSERT(library2.isNotLibraryFunction(ftok));
+        ASSERT(!library1.isNotLibraryFunction(ftok));
+        ASSERT(ftok->libraryFunction(&library1)->hasNotLibraryFunction);
+    }
+
     void function_baseClassMethod() const {
         const char xmldata[] = "<?xml version=\"1.0\"?>\n"
                                "<def>\n"
@@ -979,6 +1024,25 @@ private:
                                                         "</def>", \
                                                         Library::ErrorCode::BAD_ATTRIBUTE_VALUE)
 
+    void loadLibDuplicate() const {
+        const ScopedFile file("duplicate.cfg",
+                              "<?xml version=\"1.0\"?>\n"
+                              "<def>\n"
+                              "  <function name=\"foo\"/>\n"
+                              "</def>");
+        Library library;
+        ASSERT(library.load(nullptr, file.path().c_str()).errorcode == Library::ErrorCode::OK);
+        ASSERT_EQUALS(1U, library.functions.size());
+
+        // a file that is already loaded is not read again
+        {
+            std::ofstream fout(file.path());
+            fout << "<def>";
+        }
+        ASSERT(library.load(nullptr, file.path().c_str()).errorcode == Library::ErrorCode::OK);
+        ASSERT_EQUALS(1U, library.functions.size());
+    }
+
     void loadLibErrors() const {
 
         LOADLIBERROR("<?xml version=\"1.0\"?>\n"
@@ -518,6 +518,7 @@ private:
         // allocating member variable in public function
         TEST_CASE(func1);
         TEST_CASE(func2);
+        TEST_CASE(canRunChecks);
     }
 
 
@@ -1656,6 +1657,12 @@ private:
               "};");
         ASSERT_EQUALS("[test.cpp:9]: (warning) Possible leak in public function. The pointer 's' is not deallocated before it is allocated.\n", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckMemoryLeakInClass>("class A { int *p; };", settings));
+        ASSERT(!canRun<CheckMemoryLeakInClass>("void f() { int *p = new int; delete p; }", settings));
+        ASSERT(!canRun<CheckMemoryLeakInClass>("struct A { int *p; };", settings, "test.c"));
+    }
 };
 
 REGISTER_TEST(TestMemleakInClass)
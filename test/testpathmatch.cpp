@@ -62,6 +62,7 @@ private:
         TEST_CASE(filemaskpath2);
         TEST_CASE(filemaskpath3);
         TEST_CASE(filemaskpath4);
+        TEST_CASE(mixedmasks);
     }
 
     // Test empty PathMatch
@@ -196,6 +197,20 @@ private:
     void filemaskpath4() const {
         ASSERT(!srcFooCppMatcher.match("bar/foo.cpp"));
     }
+
+    // Test PathMatch containing several directory and file masks
+    void mixedmasks() const {
+        const PathMatch match({"src/", "lib/sub/", "foo.cpp", "a/bar.cpp"});
+        ASSERT(match.match("src/x.cpp"));
+        ASSERT(match.match("proj/src/"));
+        ASSERT(match.match("proj/lib/sub/x/y.cpp"));
+        ASSERT(!match.match("proj/lib/subx/y.cpp"));
+        ASSERT(!match.match("proj/mylib/sub.cpp"));
+        ASSERT(match.match("x/foo.cpp"));
+        ASSERT(match.match("x/a/bar.cpp"));
+        ASSERT(!match.match("x/b/bar.cpp"));
+        ASSERT(!match.match("x/src.cpp"));
+    }
 };
 
 REGISTER_TEST(TestPathMatch)
@@ -59,6 +59,7 @@ private:
         TEST_CASE(testmember);
         TEST_CASE(testcomma);
         TEST_CASE(testauto); // #8350
+        TEST_CASE(canRunChecks);
     }
 
     void testsimple() {
@@ -384,6 +385,12 @@ private:
               "}");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckPostfixOperator>("void f() { int i = 0; i++; }", settings));
+        ASSERT(!canRun<CheckPostfixOperator>("void f() { int i = 0; i++; }", settings, "test.c"));
+        ASSERT(!canRun<CheckPostfixOperator>("void f() { int i = 0; i++; }", settingsBuilder().build()));
+    }
 };
 
 REGISTER_TEST(TestPostfixOperator)
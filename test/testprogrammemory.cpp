@@ -0,0 +1,109 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2023 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "fixture.h"
+#include "helpers.h"
+#include "mathlib.h"
+#include "programmemory.h"
+#include "token.h"
+
+
+class TestProgramMemory : public TestFixture {
+public:
+    TestProgramMemory() : TestFixture("TestProgramMemory") {}
+
+private:
+    void run() override {
+        TEST_CASE(empty);
+        TEST_CASE(copyIsolatedFromOriginal);
+        TEST_CASE(originalIsolatedFromCopy);
+    }
+
+    void empty() const {
+        givenACodeSampleToTokenize data("void f() { int x = 1; }");
+        const Token* x = Token::findsimplematch(data.tokens(), "x");
+
+        ProgramMemory pm;
+        ASSERT(pm.empty());
+        ASSERT(pm.begin() == pm.end());
+        ASSERT(!pm.getValue(x->exprId()));
+
+        pm.setIntValue(x, 1);
+        ASSERT(!pm.empty());
+        pm.clear();
+        ASSERT(pm.empty());
+    }
+
+    void copyIsolatedFromOriginal() const {
+        givenACodeSampleToTokenize data("void f() { int x = 1; int y = 2; }");
+        const Token* x = Token::findsimplematch(data.tokens(), "x");
+        const Token* y = Token::findsimplematch(data.tokens(), "y");
+
+        ProgramMemory pm;
+        pm.setIntValue(x, 1);
+        const ProgramMemory copy = pm;
+
+        // writes to the original are not seen by the copy
+        pm.setIntValue(x, 2);
+        pm.setIntValue(y, 3);
+        pm.erase_if([](const ExprIdToken&) {
+            return false;
+        });
+
+        MathLib::bigint result = 0;
+        ASSERT(copy.getIntValue(x->exprId(), result));
+        ASSERT_EQUALS(1, result);
+        ASSERT(!copy.getValue(y->exprId()));
+
+        ASSERT(pm.getIntValue(x->exprId(), result));
+        ASSERT_EQUALS(2, result);
+
+        pm.clear();
+        ASSERT(copy.getIntValue(x->exprId(), result));
+        ASSERT_EQUALS(1, result);
+    }
+
+    void originalIsolatedFromCopy() const {
+        givenACodeSampleToTokenize data("void f() { int x = 1; int y = 2; }");
+        const Token* x = Token::findsimplematch(data.tokens(), "x");
+        const Token* y = Token::findsimplematch(data.tokens(), "y");
+
+        ProgramMemory pm;
+        pm.setIntValue(x, 1);
+        pm.setIntValue(y, 2);
+        ProgramMemory copy = pm;
+
+        // writes to the copy are not seen by the original
+        copy.setIntValue(x, 3);
+        copy.erase_if([&](const ExprIdToken& e) {
+            return e.getExpressionId() == y->exprId();
+        });
+
+        MathLib::bigint result = 0;
+        ASSERT(copy.getIntValue(x->exprId(), result));
+        ASSERT_EQUALS(3, result);
+        ASSERT(!copy.getValue(y->exprId()));
+
+        ASSERT(pm.getIntValue(x->exprId(), result));
+        ASSERT_EQUALS(1, result);
+        ASSERT(pm.getIntValue(y->exprId(), result));
+        ASSERT_EQUALS(2, result);
+    }
+};
+
+REGISTER_TEST(TestProgramMemory)
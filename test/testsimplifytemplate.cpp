@@ -216,6 +216,8 @@ private:
         TEST_CASE(template175); // #10908
         TEST_CASE(template176); // #11146
         TEST_CASE(template177);
+        TEST_CASE(template178); // many instantiations
+        TEST_CASE(template179); // out of line members
         TEST_CASE(template_specialization_1);  // #7868 - template specialization template <typename T> struct S<C<T>> {..};
         TEST_CASE(template_specialization_2);  // #7868 - template specialization template <typename T> struct S<C<T>> {..};
         TEST_CASE(template_enum);  // #6299 Syntax error in complex enum declaration (including template)
@@ -4518,6 +4520,38 @@ private:
         ASSERT_EQUALS(exp, tok(code));
     }
 
+    void template178() {
+        std::string code = "template <int N> struct S { int x[N]; };\n";
+        for (int i = 1; i <= 200; ++i)
+            code += "S<" + std::to_string(i) + "> s" + std::to_string(i) + "; S<" + std::to_string(i) + "> t" + std::to_string(i) + ";\n";
+        std::string exp;
+        for (int i = 1; i <= 200; ++i)
+            exp += "struct S<" + std::to_string(i) + "> ; ";
+        for (int i = 1; i <= 200; ++i)
+            exp += "S<" + std::to_string(i) + "> s" + std::to_string(i) + " ; S<" + std::to_string(i) + "> t" + std::to_string(i) + " ; ";
+        for (int i = 1; i <= 200; ++i)
+            exp += "struct S<" + std::to_string(i) + "> { int x [ " + std::to_string(i) + " ] ; } ; ";
+        exp.pop_back();
+        ASSERT_EQUALS(exp, tok(code.c_str()));
+    }
+
+    void template179() { // only templates with members implemented outside the class search for them
+        const char code[] = "template <class T> struct A { T f(); };\n"
+                            "template <class T> T A<T>::f() { return 0; }\n"
+                            "template <class T> struct B { T g() { return 1; } };\n"
+                            "template <class T> T h(T t) { return t; }\n"
+                            "A<int> a; B<int> b; A<char> c; B<char> d;\n"
+                            "int i = h<int>(0);";
+        const char exp[] = "struct A<int> ; struct A<char> ; struct B<int> ; struct B<char> ; int h<int> ( int t ) ; "
+                           "A<int> a ; B<int> b ; A<char> c ; B<char> d ; int i ; i = h<int> ( 0 ) ; "
+                           "int h<int> ( int t ) { return t ; } "
+                           "struct B<int> { int g ( ) { return 1 ; } } ; "
+                           "struct B<char> { char g ( ) { return 1 ; } } ; "
+                           "struct A<int> { int f ( ) ; } ; int A<int> :: f ( ) { return 0 ; } "
+                           "struct A<char> { char f ( ) ; } ; char A<char> :: f ( ) { return 0 ; }";
+        ASSERT_EQUALS(exp, tok(code));
+    }
+
     void template_specialization_1() {  // #7868 - template specialization template <typename T> struct S<C<T>> {..};
         const char code[] = "template <typename T> struct C {};\n"
                             "template <typename T> struct S {a};\n"
@@ -210,6 +210,7 @@ private:
         TEST_CASE(simplifyTypedef143); // #11506
         TEST_CASE(simplifyTypedef144); // #9353
         TEST_CASE(simplifyTypedef145); // #9353
+        TEST_CASE(simplifyTypedef146); // many typedefs
 
         TEST_CASE(simplifyTypedefFunction1);
         TEST_CASE(simplifyTypedefFunction2); // ticket #1685
@@ -3365,6 +3366,19 @@ private:
         ASSERT_EQUALS("void g ( ) { sizeof ( t ) ; }", tok(code)); // TODO: handle implicit int
     }
 
+    void simplifyTypedef146() {
+        // header with many typedefs, only a few of them are used
+        std::string code = "namespace N {\n";
+        for (int i = 0; i < 10000; ++i)
+            code += "typedef int T" + std::to_string(i) + ";\n";
+        code += "T0 x;\n"
+                "typedef T9999 * P;\n"
+                "P p;\n"
+                "}\n"
+                "N::T5000 y;\n";
+        ASSERT_EQUALS("namespace N { int x ; int * p ; } int y ;", tok(code.c_str()));
+    }
+
     void simplifyTypedefFunction1() {
         {
             const char code[] = "typedef void (*my_func)();\n"
@@ -173,6 +173,7 @@ private:
 
         TEST_CASE(checkKnownEmptyContainer);
         TEST_CASE(checkMutexes);
+        TEST_CASE(canRunChecks);
     }
 
 #define check(...) check_(__FILE__, __LINE__, __VA_ARGS__)
@@ -6613,6 +6614,11 @@ private:
               "}\n");
         ASSERT_EQUALS("", errout.str());
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckStl>("void f(std::vector<int> &v) { v.clear(); }", settings));
+        ASSERT(!canRun<CheckStl>("void f(int *a) { a[0] = 0; }", settings, "test.c"));
+    }
 };
 
 REGISTER_TEST(TestStl)
@@ -83,6 +83,8 @@ private:
 
         TEST_CASE(suppressingSyntaxErrorAndExitCode);
         TEST_CASE(suppressLocal);
+        TEST_CASE(suppressOrder);
+        TEST_CASE(suppressCopy);
     }
 
     void suppressionsBadId1() const {
@@ -859,6 +861,38 @@ private:
         ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid2", "test2.cpp", 1)));
         ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("errorid2", "test2.cpp", 1), false));
     }
+
+    void suppressOrder() const {
+        // the first matching suppression is marked as matched
+        Suppressions suppressions;
+        std::istringstream s("*:test.cpp\n"
+                             "errorid:test.cpp\n"
+                             "errorid2:test.cpp\n"
+                             "*:test.cpp:2");
+        ASSERT_EQUALS("", suppressions.parseFile(s));
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid", "test.cpp", 1)));
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid2", "test.cpp", 2)));
+        const std::list<Suppressions::Suppression> unmatched = suppressions.getUnmatchedLocalSuppressions("test.cpp", true);
+        ASSERT_EQUALS(2U, unmatched.size());
+        ASSERT_EQUALS("errorid", unmatched.front().errorId);
+        ASSERT_EQUALS("errorid2", unmatched.back().errorId);
+    }
+
+    void suppressCopy() const {
+        Suppressions suppressions;
+        std::istringstream s("errorid:test.cpp");
+        ASSERT_EQUALS("", suppressions.parseFile(s));
+
+        Suppressions copy(suppressions);
+        ASSERT_EQUALS(true, copy.isSuppressed(errorMessage("errorid", "test.cpp", 1)));
+        ASSERT_EQUALS(true, copy.getUnmatchedLocalSuppressions("test.cpp", true).empty());
+        ASSERT_EQUALS(false, suppressions.getUnmatchedLocalSuppressions("test.cpp", true).empty());
+
+        copy = suppressions;
+        ASSERT_EQUALS(false, copy.getUnmatchedLocalSuppressions("test.cpp", true).empty());
+        ASSERT_EQUALS(true, copy.isSuppressed(errorMessage("errorid", "test.cpp", 1)));
+        ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("errorid", "test2.cpp", 1)));
+    }
 };
 
 REGISTER_TEST(TestSuppressions)
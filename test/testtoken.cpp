@@ -93,6 +93,7 @@ private:
         TEST_CASE(operators);
 
         TEST_CASE(updateProperties);
+        TEST_CASE(numberLiterals);
         TEST_CASE(isNameGuarantees1);
         TEST_CASE(isNameGuarantees2);
         TEST_CASE(isNameGuarantees3);
@@ -110,6 +111,8 @@ private:
         TEST_CASE(expressionString);
 
         TEST_CASE(hasKnownIntValue);
+        TEST_CASE(impossibleBoundCoversValue);
+        TEST_CASE(impossibleBoundTokValue);
     }
 
     void nextprevious() const {
@@ -998,6 +1001,28 @@ private:
         ASSERT_EQUALS(true, tok.isNumber());
     }
 
+    void numberLiterals() const {
+        Token tok;
+        tok.str("0x10U");
+        ASSERT_EQUALS(true, tok.isIntNumber());
+        ASSERT_EQUALS(false, tok.isFloatNumber());
+        ASSERT_EQUALS(16, tok.toLongNumber());
+        ASSERT_EQUALS(16, tok.toLongNumber());
+
+        tok.str("1.5f");
+        ASSERT_EQUALS(false, tok.isIntNumber());
+        ASSERT_EQUALS(true, tok.isFloatNumber());
+        ASSERT_EQUALS_DOUBLE(1.5, tok.toDoubleNumber(), 1E-6);
+
+        tok.str("'a'");
+        ASSERT_EQUALS(false, tok.isIntNumber());
+        ASSERT_EQUALS(97, tok.toLongNumber());
+
+        tok.str("x");
+        ASSERT_EQUALS(false, tok.isIntNumber());
+        ASSERT_EQUALS(false, tok.isFloatNumber());
+    }
+
     void isNameGuarantees1() const {
         Token tok;
         tok.str("Name");
@@ -1120,6 +1145,44 @@ private:
         ASSERT_EQUALS(true, token.addValue(v2));
         ASSERT_EQUALS(false, token.hasKnownIntValue());
     }
+
+    void impossibleBoundCoversValue() const {
+        // x can not be 1
+        ValueFlow::Value v1(1);
+        v1.setImpossible();
+
+        // x can not be <= 2
+        ValueFlow::Value v2(2);
+        v2.bound = ValueFlow::Value::Bound::Upper;
+        v2.setImpossible();
+
+        Token token;
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(true, token.addValue(v2));
+        ASSERT_EQUALS(1U, token.values().size());
+        ASSERT_EQUALS(2, token.values().front().intvalue);
+    }
+
+    void impossibleBoundTokValue() const {
+        givenACodeSampleToTokenize data("a b", true);
+
+        // TOK values have no order, a bound does not cover other TOK values
+        ValueFlow::Value v1;
+        v1.valueType = ValueFlow::Value::ValueType::TOK;
+        v1.tokvalue = data.tokens();
+        v1.setImpossible();
+
+        ValueFlow::Value v2;
+        v2.valueType = ValueFlow::Value::ValueType::TOK;
+        v2.tokvalue = data.tokens()->next();
+        v2.bound = ValueFlow::Value::Bound::Upper;
+        v2.setImpossible();
+
+        Token token;
+        ASSERT_EQUALS(true, token.addValue(v1));
+        ASSERT_EQUALS(true, token.addValue(v2));
+        ASSERT_EQUALS(2U, token.values().size());
+    }
 };
 
 REGISTER_TEST(TestToken)
@@ -264,6 +264,7 @@ private:
         TEST_CASE(functionAttributeAfter2);
         TEST_CASE(functionAttributeListBefore);
         TEST_CASE(functionAttributeListAfter);
+        TEST_CASE(functionAttributeMixed);
 
         TEST_CASE(splitTemplateRightAngleBrackets);
 
@@ -450,6 +451,9 @@ private:
         TEST_CASE(cpp20_default_bitfield_initializer);
 
         TEST_CASE(cpp11init);
+
+        TEST_CASE(tokensWithStr);
+        TEST_CASE(tokensWithStrNotFinal);
     }
 
 #define tokenizeAndStringify(...) tokenizeAndStringify_(__FILE__, __LINE__, __VA_ARGS__)
@@ -3960,6 +3964,45 @@ private:
         ASSERT(func8 && func8->isAttributeNoreturn() && func8->isAttributePure() && func8->isAttributeNothrow() && func8->isAttributeConst());
     }
 
+    void functionAttributeMixed() {
+        const char code[] = "[[noreturn]] __attribute__((nothrow)) void func1();\n"
+                            "__attribute__((pure)) [[nodiscard]] void func2();\n"
+                            "void func3(__cppcheck_low__(0) [[maybe_unused]] int x);";
+        const char expected[] = "void func1 ( ) ; void func2 ( ) ; void func3 ( int x ) ;";
+
+        errout.str("");
+
+        // tokenize..
+        Tokenizer tokenizer(&settings0, this);
+        std::istringstream istr(code);
+        ASSERT(tokenizer.tokenize(istr, "test.cpp"));
+
+        // Expected result..
+        ASSERT_EQUALS(expected, tokenizer.tokens()->stringifyList(nullptr, false));
+
+        const Token * func1 = Token::findsimplematch(tokenizer.tokens(), "func1");
+        const Token * func2 = Token::findsimplematch(tokenizer.tokens(), "func2");
+        const Token * x = Token::findsimplematch(tokenizer.tokens(), "x");
+
+        ASSERT(func1 && func1->isAttributeNoreturn() && func1->isAttributeNothrow());
+        ASSERT(func2 && func2->isAttributePure() && func2->isAttributeNodiscard());
+        MathLib::bigint low = -1;
+        ASSERT(x && x->getCppcheckAttribute(TokenImpl::CppcheckAttributes::Type::LOW, low));
+        ASSERT_EQUALS(0, low);
+        // C++11 attribute in front of an __attribute__ after the declarator
+        const char code2[] = "int f(int x) [[gnu::hot]] __attribute__((pure));\n"
+                             "void g(int x) [[gnu::cold]] __attribute__((noreturn));";
+        Tokenizer tokenizer2(&settings0, this);
+        std::istringstream istr2(code2);
+        ASSERT(tokenizer2.tokenize(istr2, "test.cpp"));
+        ASSERT_EQUALS("int f ( int x ) ; void g ( int x ) ;", tokenizer2.tokens()->stringifyList(nullptr, false));
+
+        const Token * f = Token::findsimplematch(tokenizer2.tokens(), "f");
+        const Token * g = Token::findsimplematch(tokenizer2.tokens(), "g");
+        ASSERT(f && f->isAttributePure());
+        ASSERT(g && g->isAttributeNoreturn());
+    }
+
     void functionAttributeListAfter() {
         const char code[] = "void func1() __attribute__((pure,nothrow,const));\n"
                             "void func2() __attribute__((__pure__,__nothrow__,__const__));\n"
@@ -7844,6 +7887,44 @@ private:
                                              "template<typename T> auto f(T t) -> X<decltype(t + 1)> {}\n"));
         #undef testIsCpp11init
     }
+
+    void tokensWithStr() {
+        const char code[] = "void f(int a, int b) {\n"
+                            "    a = sizeof(a);\n"
+                            "    b = a + 1;\n"
+                            "}\n";
+        Tokenizer tokenizer(&settings0, this);
+        std::istringstream istr(code);
+        ASSERT(tokenizer.tokenize(istr, "test.cpp"));
+
+        const std::vector<const Token *> &assignments = tokenizer.tokensWithStr("=");
+        ASSERT_EQUALS(2, assignments.size());
+        ASSERT_EQUALS(2, assignments[0]->linenr());
+        ASSERT_EQUALS(3, assignments[1]->linenr());
+
+        const std::vector<const Token *> &names = tokenizer.tokensWithStr("a");
+        ASSERT_EQUALS(4, names.size());
+        ASSERT(names[0]->isName());
+
+        ASSERT_EQUALS(0, tokenizer.tokensWithStr("1").size()); // literals are not indexed
+        ASSERT_EQUALS(0, tokenizer.tokensWithStr("while").size());
+    }
+
+    void tokensWithStrNotFinal() {
+        Tokenizer tokenizer(&settings0, this);
+        std::istringstream istr("a = b ; a = c ;");
+        ASSERT(tokenizer.list.createTokens(istr, "test.cpp"));
+        ASSERT(!tokenizer.list.isFinal());
+
+        ASSERT_EQUALS(2, tokenizer.tokensWithStr("a").size());
+        ASSERT_EQUALS(2, tokenizer.tokensWithStr("=").size());
+
+        // the token list is scanned again, so changes are seen
+        tokenizer.list.back()->insertToken("a");
+        ASSERT_EQUALS(3, tokenizer.tokensWithStr("a").size());
+        tokenizer.tokens()->next()->deleteThis();
+        ASSERT_EQUALS(1, tokenizer.tokensWithStr("=").size());
+    }
 };
 
 REGISTER_TEST(TestTokenizer)
@@ -53,6 +53,7 @@ private:
         TEST_CASE(va_list_usedBeforeStarted);
         TEST_CASE(va_start_subsequentCalls);
         TEST_CASE(unknownFunctionScope);
+        TEST_CASE(canRunChecks);
     }
 
     void wrongParameterTo_va_start() {
@@ -361,6 +362,12 @@ private:
               "  va_end(va);\n"
               "}");
     }
+
+    void canRunChecks() {
+        ASSERT(canRun<CheckVaarg>("void f(int n, ...) { va_list ap; va_start(ap, n); va_end(ap); }", settings));
+        ASSERT(canRun<CheckVaarg>("void f(va_list ap) {}", settings));
+        ASSERT(!canRun<CheckVaarg>("void f(int n) {}", settings));
+    }
 };
 
 REGISTER_TEST(TestVaarg)
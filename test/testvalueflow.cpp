@@ -161,9 +161,12 @@ private:
         TEST_CASE(valueFlowSmartPointer);
         TEST_CASE(valueFlowImpossibleMinMax);
         TEST_CASE(valueFlowImpossibleUnknownConstant);
+        TEST_CASE(valueFlowImpossibleCovered);
+        TEST_CASE(valueFlowIndependentStatements);
         TEST_CASE(valueFlowContainerEqual);
 
         TEST_CASE(performanceIfCount);
+        TEST_CASE(performanceForwardBudget);
     }
 
     static bool isNotTokValue(const ValueFlow::Value &val) {
@@ -4070,6 +4073,7 @@ private:
     void valueFlowForLoop() {
         const char *code;
         ValueFlow::Value value;
+        std::list<ValueFlow::Value> values;
 
         code = "void f() {\n"
                "    for (int x = 0; x < 10; x++)\n"
@@ -4126,6 +4130,57 @@ private:
         ASSERT_EQUALS(true, testValueOfX(code, 3U, 8));
         ASSERT_EQUALS(false, testValueOfX(code, 3U, 10));
 
+        code = "void f(int *a) {\n"
+               "    int x;\n"
+               "    for (x = 1; x <= 10; x += 4)\n"
+               "        a[x] = 0;\n"
+               "    a[x] = 1;\n"
+               "}";
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 1));
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 9));
+        ASSERT_EQUALS(false, testValueOfX(code, 4U, 10));
+        ASSERT_EQUALS(true, testValueOfX(code, 5U, 13));
+
+        code = "void f(int *a) {\n"
+               "    int x;\n"
+               "    for (x = 10; x > 0; x -= 3)\n"
+               "        a[x] = 0;\n"
+               "    a[x] = 1;\n"
+               "}";
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 10));
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 1));
+        ASSERT_EQUALS(false, testValueOfX(code, 4U, 0));
+        ASSERT_EQUALS(true, testValueOfX(code, 5U, -2));
+
+        // The closed form is not used when the values overflow
+        code = "long long f() {\n"
+               "    long long x;\n"
+               "    for (x = 0; x <= 9223372036854775807; x += 2) {}\n"
+               "    return x;\n"
+               "}";
+        values = tokenValues(code, "x ; }");
+        ASSERT_EQUALS(true, std::none_of(values.cbegin(), values.cend(), [](const ValueFlow::Value& v) {
+            return v.intvalue == LLONG_MIN;
+        }));
+
+        code = "void f(long long *a) {\n"
+               "    for (long long x = 9223372036854775807; x >= -9223372036854775807 - 1; x -= 2)\n"
+               "        a[0] = x;\n"
+               "}";
+        values = tokenValues(code, "x ;");
+        ASSERT_EQUALS(true, std::none_of(values.cbegin(), values.cend(), std::mem_fn(&ValueFlow::Value::isImpossible)));
+
+        code = "void f(int *a) {\n"
+               "    int x, y;\n"
+               "    for (x = 0, y = 9; x < y; x += 2, y--)\n"
+               "        a[x] = 0;\n"
+               "    a[x] = 1;\n"
+               "}";
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 0));
+        ASSERT_EQUALS(true, testValueOfX(code, 4U, 4));
+        ASSERT_EQUALS(false, testValueOfX(code, 4U, 6));
+        ASSERT_EQUALS(true, testValueOfX(code, 5U, 6));
+
         code = "void f() {\n"
                "    for (int x = 0; x < 10; x = x / 0)\n"
                "        a[x] = 0;\n"
@@ -4341,7 +4396,7 @@ private:
                "    for (x = 0; x < 10; x++)\n"
                "        x;\n"
                "}";
-        std::list<ValueFlow::Value> values = tokenValues(code, "x <");
+        values = tokenValues(code, "x <");
         ASSERT(std::none_of(values.cbegin(), values.cend(), std::mem_fn(&ValueFlow::Value::isUninitValue)));
 
         // #9637
@@ -4530,6 +4585,18 @@ private:
                "}\n";
         ASSERT_EQUALS(true, testValueOfX(code, 3U, 1));
         ASSERT_EQUALS(true, testValueOfX(code, 3U, 0));
+
+        code = "void f(int x) {\n"
+               "    int a = x;\n"
+               "}\n"
+               "void g(int i) {\n"
+               "    f(1);\n"
+               "    f(1);\n"
+               "    if (i == 2)\n"
+               "        f(i);\n"
+               "}\n";
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 1));
+        ASSERT_EQUALS(true, testValueOfX(code, 2U, 2));
     }
     void valueFlowFunctionReturn() {
         const char *code;
@@ -8073,6 +8140,82 @@ private:
         ASSERT_EQUALS(true, testValueOfXImpossible(code, 4U, 0));
     }
 
+    void valueFlowImpossibleCovered()
+    {
+        // The impossible value 1 is implied by the impossible bound <= 2
+        const char* code = "int f(int x) {\n"
+                           "    if (x == 1)\n"
+                           "        return 0;\n"
+                           "    if (x < 3)\n"
+                           "        return 0;\n"
+                           "    return x;\n"
+                           "}\n";
+        const std::list<ValueFlow::Value> values = tokenValues(code, "x ;");
+        ASSERT_EQUALS(1, std::count_if(values.begin(), values.end(), std::mem_fn(&ValueFlow::Value::isImpossible)));
+        ASSERT_EQUALS(true, testValueOfXImpossible(code, 6U, 2));
+        ASSERT_EQUALS(false, testValueOfXImpossible(code, 6U, 1));
+    }
+
+    void valueFlowIndependentStatements()
+    {
+        const char* code;
+
+        // write through a pointer alias
+        code = "int f() {\n"
+               "    int x = 0;\n"
+               "    int* p = &x;\n"
+               "    *p = 1;\n"
+               "    return x;\n"
+               "}\n";
+        ASSERT_EQUALS(false, testValueOfXKnown(code, 5U, 0));
+
+        // write through a reference alias
+        code = "int f() {\n"
+               "    int x = 0;\n"
+               "    int& r = x;\n"
+               "    r = 1;\n"
+               "    return x;\n"
+               "}\n";
+        ASSERT_EQUALS(false, testValueOfXKnown(code, 5U, 0));
+
+        // call that modifies a global
+        code = "int x;\n"
+               "void g() { x = 1; }\n"
+               "int f() {\n"
+               "    x = 0;\n"
+               "    g();\n"
+               "    return x;\n"
+               "}\n";
+        ASSERT_EQUALS(false, testValueOfXKnown(code, 6U, 0));
+
+        // member call when the value depends on this
+        code = "struct A {\n"
+               "    int x;\n"
+               "    void g();\n"
+               "    int f() {\n"
+               "        x = 0;\n"
+               "        g();\n"
+               "        return x;\n"
+               "    }\n"
+               "};\n";
+        ASSERT_EQUALS(false, testValueOfXKnown(code, 7U, 0));
+
+        // the value reaches the use after many independent statements
+        code = "int f(int a, int b, int* c) {\n"
+               "    int x = 3;\n"
+               "    a = b + 1;\n"
+               "    b = a * 2;\n"
+               "    c[a] = b;\n"
+               "    a += c[b];\n"
+               "    b = a - b;\n"
+               "    c[0] = a;\n"
+               "    a = b = 0;\n"
+               "    b++;\n"
+               "    return x + a + b;\n"
+               "}\n";
+        ASSERT_EQUALS(true, testValueOfXKnown(code, 11U, 3));
+    }
+
     void valueFlowContainerEqual()
     {
         const char* code;
@@ -8151,6 +8294,33 @@ private:
                "}\n";
         ASSERT_EQUALS(1U, tokenValues(code, "v .", &s).size());
     }
+
+    void performanceForwardBudget() {
+        Settings s(settings);
+        s.performanceValueFlowForwardBudget = 10;
+
+        const char *code;
+
+        code = "int f(int a, int b, int c) {\n"
+               "  int x = 1;\n"
+               "  a = b + c;\n"
+               "  b = a + c;\n"
+               "  c = a + b;\n"
+               "  a = b + c;\n"
+               "  b = a + c;\n"
+               "  c = a + b;\n"
+               "  return x;\n"
+               "}\n";
+        ASSERT_EQUALS(0U, tokenValues(code, "x ; }", &s).size());
+        ASSERT_EQUALS(1U, tokenValues(code, "x ; }").size());
+
+        // the bailout is reported once for the function
+        s.debugwarnings = true;
+        ASSERT_EQUALS(0U, tokenValues(code, "x ; }", &s).size());
+        ASSERT_EQUALS_WITHOUT_LINENUMBERS(
+            "[test.cpp:1]: (debug) valueflow.cpp::reportForwardBudgets bailout: forward analysis budget exceeded in f\n",
+            errout.str());
+    }
 };
 
 REGISTER_TEST(TestValueFlow)
@@ -210,6 +210,7 @@ private:
         TEST_CASE(varidclass18);
         TEST_CASE(varidclass19);  // initializer list
         TEST_CASE(varidclass20);   // #7578: int (*p)[2]
+        TEST_CASE(varidclass21);   // many classes with out of line members
         TEST_CASE(varid_classnameshaddowsvariablename); // #3990
         TEST_CASE(varid_classnametemplate); // #10221
 
@@ -3529,6 +3530,23 @@ private:
         ASSERT_EQUALS(expected, tokenize(code));
     }
 
+    void varidclass21() { // many classes with out of line members
+        const int n = 50;
+        std::string code;
+        std::string expected;
+        for (int i = 1; i <= n; ++i) {
+            const std::string c = "C" + std::to_string(i);
+            code += "struct " + c + " { int x; void f(); };\n";
+            expected += std::to_string(i) + ": struct " + c + " { int x@" + std::to_string(i) + " ; void f ( ) ; } ;\n";
+        }
+        for (int i = 1; i <= n; ++i) {
+            const std::string c = "C" + std::to_string(i);
+            code += "void " + c + "::f() { x = 0; }\n";
+            expected += std::to_string(n + i) + ": void " + c + " :: f ( ) { x@" + std::to_string(i) + " = 0 ; }\n";
+        }
+        ASSERT_EQUALS(expected, tokenize(code.c_str()));
+    }
+
     void varidenum1() {
         const char code[] = "const int eStart = 6;\n"
                             "enum myEnum {\n"